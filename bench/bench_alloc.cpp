@@ -0,0 +1,81 @@
+/**
+ * @file bench_alloc.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 替换全局 operator new/delete 以统计分配次数
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <cstdlib>
+#include <new>
+#include "bench_alloc.h"
+
+// 替换实现放在单独的编译单元中，避免被内联到调用方后与 malloc/free 混用而触发 -Wmismatched-new-delete
+// 所有形式的 new 均经过 Allocate 计数，所有形式的 delete 均经过 Deallocate 释放，保证成对匹配
+std::atomic<size_t> g_allocCount(0);
+
+static void* Allocate(size_t size)
+{
+    CountAllocation();
+    return malloc(size == 0 ? 1 : size);
+}
+
+static void Deallocate(void* ptr) noexcept { free(ptr); }
+
+void* operator new(size_t size)
+{
+    void* ptr = Allocate(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept { return Allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t& /*tag*/) noexcept { return Allocate(size); }
+
+void operator delete(void* ptr) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, size_t /*size*/) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, size_t /*size*/) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept { Deallocate(ptr); }
+
+#if defined(__cpp_aligned_new)
+// 对齐分配使用 aligned_alloc，其返回的内存同样由 free 释放
+static void* AllocateAligned(size_t size, std::align_val_t align)
+{
+    CountAllocation();
+    size_t alignment = static_cast<size_t>(align);
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void* operator new(size_t size, std::align_val_t align)
+{
+    void* ptr = AllocateAligned(size == 0 ? 1 : size, align);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t align) { return operator new(size, align); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t& /*tag*/) noexcept
+{
+    return AllocateAligned(size == 0 ? 1 : size, align);
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t& /*tag*/) noexcept
+{
+    return AllocateAligned(size == 0 ? 1 : size, align);
+}
+
+void operator delete(void* ptr, std::align_val_t /*align*/) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t /*align*/) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, size_t /*size*/, std::align_val_t /*align*/) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, size_t /*size*/, std::align_val_t /*align*/) noexcept { Deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t /*align*/, const std::nothrow_t& /*tag*/) noexcept { Deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t /*align*/, const std::nothrow_t& /*tag*/) noexcept { Deallocate(ptr); }
+#endif
@@ -0,0 +1,21 @@
+/**
+ * @file bench_alloc.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 基准测试的内存分配计数，全局 operator new/delete 的替换实现位于 bench_alloc.cpp
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// 进程内 operator new 以及计数分配器的调用次数，多线程基准同样计入
+extern std::atomic<size_t> g_allocCount;
+
+inline void CountAllocation() { g_allocCount.fetch_add(1, std::memory_order_relaxed); }
+
+inline size_t AllocationCount() { return g_allocCount.load(std::memory_order_relaxed); }
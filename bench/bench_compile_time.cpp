@@ -0,0 +1,72 @@
+/**
+ * @file bench_compile_time.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 编译期基准：不同字段数下 DEFINE_STRUCT_WITH_TUPLE_INTERFACE 的预处理与模板实例化开销
+ * @version 0.1
+ * @date 2025-08-30
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * 该文件不参与链接，由 bench_compile_time.sh 以 -DBENCH_FIELD_COUNT=16/64/128 分别编译并计时：
+ * -E 只统计预处理，-fsyntax-only 统计预处理 + 模板实例化
+ */
+
+#include <cstdint>
+#include "define_tuple_interface.h"
+#include "json_reader.h"
+#include "json_text_writer.h"
+#include "json_writer.h"
+
+#ifndef BENCH_FIELD_COUNT
+#define BENCH_FIELD_COUNT 128
+#endif
+
+#define BENCH_FIELDS_16 \
+    (int32_t, f0), (double, f1), (uint64_t, f2), (bool, f3), (int32_t, f4), (double, f5), \
+    (uint64_t, f6), (bool, f7), (int32_t, f8), (double, f9), (uint64_t, f10), (bool, f11), \
+    (int32_t, f12), (double, f13), (uint64_t, f14), (bool, f15)
+
+#define BENCH_FIELDS_64 \
+    BENCH_FIELDS_16, \
+    (int32_t, f16), (double, f17), (uint64_t, f18), (bool, f19), (int32_t, f20), (double, f21), \
+    (uint64_t, f22), (bool, f23), (int32_t, f24), (double, f25), (uint64_t, f26), (bool, f27), \
+    (int32_t, f28), (double, f29), (uint64_t, f30), (bool, f31), (int32_t, f32), (double, f33), \
+    (uint64_t, f34), (bool, f35), (int32_t, f36), (double, f37), (uint64_t, f38), (bool, f39), \
+    (int32_t, f40), (double, f41), (uint64_t, f42), (bool, f43), (int32_t, f44), (double, f45), \
+    (uint64_t, f46), (bool, f47), (int32_t, f48), (double, f49), (uint64_t, f50), (bool, f51), \
+    (int32_t, f52), (double, f53), (uint64_t, f54), (bool, f55), (int32_t, f56), (double, f57), \
+    (uint64_t, f58), (bool, f59), (int32_t, f60), (double, f61), (uint64_t, f62), (bool, f63)
+
+#define BENCH_FIELDS_128 \
+    BENCH_FIELDS_64, \
+    (int32_t, f64), (double, f65), (uint64_t, f66), (bool, f67), (int32_t, f68), (double, f69), \
+    (uint64_t, f70), (bool, f71), (int32_t, f72), (double, f73), (uint64_t, f74), (bool, f75), \
+    (int32_t, f76), (double, f77), (uint64_t, f78), (bool, f79), (int32_t, f80), (double, f81), \
+    (uint64_t, f82), (bool, f83), (int32_t, f84), (double, f85), (uint64_t, f86), (bool, f87), \
+    (int32_t, f88), (double, f89), (uint64_t, f90), (bool, f91), (int32_t, f92), (double, f93), \
+    (uint64_t, f94), (bool, f95), (int32_t, f96), (double, f97), (uint64_t, f98), (bool, f99), \
+    (int32_t, f100), (double, f101), (uint64_t, f102), (bool, f103), (int32_t, f104), (double, f105), \
+    (uint64_t, f106), (bool, f107), (int32_t, f108), (double, f109), (uint64_t, f110), (bool, f111), \
+    (int32_t, f112), (double, f113), (uint64_t, f114), (bool, f115), (int32_t, f116), (double, f117), \
+    (uint64_t, f118), (bool, f119), (int32_t, f120), (double, f121), (uint64_t, f122), (bool, f123), \
+    (int32_t, f124), (double, f125), (uint64_t, f126), (bool, f127)
+
+#define BENCH_FIELDS PP_CAT(BENCH_FIELDS_, BENCH_FIELD_COUNT)
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchWide, BENCH_FIELDS)
+
+static_assert(std::tuple_size<BenchWide>::value == BENCH_FIELD_COUNT, "unexpected field count");
+
+using namespace csrl;
+
+// 实例化按字段展开的 JSON 读写路径：DOM 构建、流式写入以及按字段名分发的解析
+int32_t InstantiateWideStruct()
+{
+    BenchWide value{};
+    yyjson_mut_doc* doc = ToJson(value);
+    yyjson_mut_doc_free(doc);
+
+    JsonTextWriter writer;
+    writer.Write(value);
+    return FromJson(writer.data(), writer.size(), value);
+}
@@ -0,0 +1,38 @@
+#!/bin/sh
+# 编译期基准：分别以 16/64/128 个字段编译 bench_compile_time.cpp，输出预处理与完整前端（含模板实例化）耗时
+# 用法：bench_compile_time.sh <C++ 编译器> <项目根目录> [重复次数]
+
+set -e
+
+CXX=${1:-c++}
+ROOT=${2:-$(dirname "$0")/..}
+REPEAT=${3:-5}
+SOURCE="$ROOT/bench/bench_compile_time.cpp"
+FLAGS="-std=c++14 -I$ROOT/include -I$ROOT/include/core -I$ROOT/include/json -I$ROOT/include/tlv -I$ROOT/include/thirdparty"
+
+# 取多次运行的最小值，单位毫秒
+measure() {
+    best=""
+    i=0
+    while [ "$i" -lt "$REPEAT" ]; do
+        start=$(date +%s%N)
+        # shellcheck disable=SC2086
+        "$CXX" $FLAGS "$@" "$SOURCE" -o /dev/null
+        end=$(date +%s%N)
+        elapsed=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best=$elapsed
+        fi
+        i=$((i + 1))
+    done
+    echo "$best"
+}
+
+printf "%-8s %14s %18s %14s\n" "fields" "preprocess(ms)" "syntax-only(ms)" "expanded(KB)"
+for count in 16 64 128; do
+    # shellcheck disable=SC2086
+    size=$("$CXX" $FLAGS -DBENCH_FIELD_COUNT=$count -E "$SOURCE" | wc -c)
+    pre=$(measure -DBENCH_FIELD_COUNT=$count -E)
+    full=$(measure -DBENCH_FIELD_COUNT=$count -fsyntax-only)
+    printf "%-8s %14s %18s %14s\n" "$count" "$pre" "$full" "$((size / 1024))"
+done
@@ -0,0 +1,566 @@
+/**
+ * @file bench_serialize.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 序列化热点路径的基准测试，输出吞吐量（bytes/sec）与每次操作的内存分配次数（allocs/op）
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench_alloc.h"
+#include "define_tuple_interface.h"
+#include "field_convert.h"
+#include "json_reader.h"
+#include "json_text_writer.h"
+#include "json_writer.h"
+#include "tlv_parallel.h"
+#include "tlv_writer.h"
+#include "tlv_writer_pool.h"
+#include "yyjson.h"
+
+// yyjson 通过 malloc 分配内存，使用计数分配器统计
+static void* CountingMalloc(void* /*ctx*/, size_t size)
+{
+    CountAllocation();
+    return malloc(size);
+}
+
+static void* CountingRealloc(void* /*ctx*/, void* ptr, size_t /*oldSize*/, size_t size)
+{
+    CountAllocation();
+    return realloc(ptr, size);
+}
+
+static void CountingFree(void* /*ctx*/, void* ptr) { free(ptr); }
+
+static const yyjson_alc COUNTING_ALC = {CountingMalloc, CountingRealloc, CountingFree, nullptr};
+
+// 在作用域结束时将循环内的分配次数折算为每次迭代的平均值
+class AllocationCounter {
+public:
+    explicit AllocationCounter(benchmark::State& state) : m_state(state), m_start(AllocationCount()) {}
+
+    ~AllocationCounter()
+    {
+        m_state.counters["allocs/op"] =
+            benchmark::Counter(static_cast<double>(AllocationCount() - m_start), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& m_state;
+    size_t m_start;
+};
+
+using namespace csrl;
+
+using Int32Array1024 = int32_t[1024];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchInner,
+    (int32_t, a),
+    (int32_t, b),
+    (double, c)
+);
+
+using BenchInnerArray16 = BenchInner[16];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchFlat,
+    (int32_t, id),
+    (uint32_t, flags),
+    (int64_t, timestamp),
+    (float, ratio),
+    (double, value),
+    (uint16_t, channel),
+    (BenchInner, inner)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchNested,
+    (int32_t, id),
+    (BenchInner, inner),
+    (BenchInnerArray16, innerArray)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchArray,
+    (uint32_t, length),
+    (Int32Array1024, data)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchSample,
+    (int32_t, x),
+    (int32_t, y),
+    (int16_t, level),
+    (uint32_t, flags)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BenchSampleF,
+    (float, x),
+    (float, y),
+    (int32_t, level),
+    (uint32_t, flags)
+);
+
+static const char BENCH_KEY[] = "benchmark_key";
+
+static BenchFlat MakeBenchFlat()
+{
+    return BenchFlat{42, 0x5a5a, 1722556800000LL, 0.5f, 3.14159, 3, {1, 2, 3.5}};
+}
+
+// TLVWriter::AppendBuf：每次迭代写入 64 条指定长度的记录
+static void BM_TLVWriter_AppendBuf(benchmark::State& state)
+{
+    std::string value(static_cast<size_t>(state.range(0)), 'x');
+    TLVWriter writer(64 * (TLV_HEADER_SIZE + value.size()));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.clear();
+        for (int i = 0; i < 64; ++i) {
+            writer.AppendBuf(static_cast<uint32_t>(i), value.data(), value.size());
+        }
+        benchmark::DoNotOptimize(writer.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer.size()));
+}
+BENCHMARK(BM_TLVWriter_AppendBuf)->Arg(8)->Arg(64)->Arg(4096);
+
+// TLVWriter::AppendPair：键名 + 值两段数据
+static void BM_TLVWriter_AppendPair(benchmark::State& state)
+{
+    std::string value(static_cast<size_t>(state.range(0)), 'x');
+    TLVWriter writer(64 * (TLV_HEADER_SIZE + sizeof(BENCH_KEY) + value.size()));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.clear();
+        for (int i = 0; i < 64; ++i) {
+            writer.AppendPair(static_cast<uint32_t>(i), BENCH_KEY, sizeof(BENCH_KEY), value.data(), value.size());
+        }
+        benchmark::DoNotOptimize(writer.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer.size()));
+}
+BENCHMARK(BM_TLVWriter_AppendPair)->Arg(8)->Arg(64)->Arg(4096);
+
+// 结构体到结构体：映射规则转换
+static void BM_StructFieldsConvert(benchmark::State& state)
+{
+    auto innerRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>())
+    );
+    auto rules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<3>(), MakeFieldPath<3>()),
+        MakeFieldMappingRule(MakeFieldPath<4>(), MakeFieldPath<4>()),
+        MakeFieldMappingRule(MakeFieldPath<5>(), MakeFieldPath<5>()),
+        MakeStructFieldMappingRule(MakeFieldPath<6>(), MakeFieldPath<6>(), innerRules)
+    );
+    BenchFlat src = MakeBenchFlat();
+    BenchFlat dst{};
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src);
+        StructFieldsConvert(src, dst, rules);
+        benchmark::DoNotOptimize(dst);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sizeof(BenchFlat)));
+}
+BENCHMARK(BM_StructFieldsConvert);
+
+// 结构体到结构体：手写赋值，作为映射规则转换的对照
+static void BM_StructHandWritten(benchmark::State& state)
+{
+    BenchFlat src = MakeBenchFlat();
+    BenchFlat dst{};
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src);
+        dst.id = src.id;
+        dst.flags = src.flags;
+        dst.timestamp = src.timestamp;
+        dst.ratio = src.ratio;
+        dst.value = src.value;
+        dst.channel = src.channel;
+        dst.inner.a = src.inner.a;
+        dst.inner.b = src.inner.b;
+        dst.inner.c = src.inner.c;
+        benchmark::DoNotOptimize(dst);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * sizeof(BenchFlat)));
+}
+BENCHMARK(BM_StructHandWritten);
+
+static auto MakeBenchSampleRules()
+{
+    return MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<3>(), MakeFieldPath<3>())
+    );
+}
+
+// 结构体数组：逐个元素调用 StructFieldsConvert，作为批量转换的对照
+static void BM_StructFieldsConvertLoop(benchmark::State& state)
+{
+    auto rules = MakeBenchSampleRules();
+    std::vector<BenchSample> src(static_cast<size_t>(state.range(0)), BenchSample{1, -2, 3, 4});
+    std::vector<BenchSampleF> dst(src.size());
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src.data());
+        for (size_t i = 0; i < src.size(); ++i) {
+            StructFieldsConvert(src[i], dst[i], rules);
+        }
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size() * sizeof(BenchSample)));
+}
+BENCHMARK(BM_StructFieldsConvertLoop)->Arg(1024)->Arg(1 << 16);
+
+// 结构体数组：批量转换，第二个参数为线程数，多线程时按墙钟时间统计
+static void BM_StructFieldsConvertBatch(benchmark::State& state)
+{
+    auto rules = MakeBenchSampleRules();
+    std::vector<BenchSample> src(static_cast<size_t>(state.range(0)), BenchSample{1, -2, 3, 4});
+    std::vector<BenchSampleF> dst(src.size());
+    size_t threadCount = static_cast<size_t>(state.range(1));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src.data());
+        StructFieldsConvertBatch(src.data(), dst.data(), src.size(), rules, threadCount);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size() * sizeof(BenchSample)));
+}
+BENCHMARK(BM_StructFieldsConvertBatch)->Args({1024, 1})->Args({1 << 16, 1})->Args({1 << 20, 1})->Args({1 << 20, 4})->UseRealTime();
+
+// 结构体数组：源、目标类型相同，所有规则合并为一个覆盖整个结构体的按位拷贝段，每个分块一次 memcpy
+static void BM_StructFieldsConvertBatchCopy(benchmark::State& state)
+{
+    auto rules = MakeBenchSampleRules();
+    std::vector<BenchSample> src(static_cast<size_t>(state.range(0)), BenchSample{1, -2, 3, 4});
+    std::vector<BenchSample> dst(src.size());
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src.data());
+        StructFieldsConvertBatch(src.data(), dst.data(), src.size(), rules, 1);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * src.size() * sizeof(BenchSample)));
+}
+BENCHMARK(BM_StructFieldsConvertBatchCopy)->Arg(1 << 16);
+
+// 嵌套子结构体：子结构体及子结构体数组逐字段写入 TLV
+static void BM_SubStructTLV(benchmark::State& state)
+{
+    auto innerRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x21),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x22),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x23)
+    );
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<1>(), 0x12, innerRules),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<2>(), 0x13, innerRules)
+    );
+    BenchNested src{};
+    src.id = 7;
+    for (int32_t i = 0; i < 16; ++i) {
+        src.innerArray[i] = BenchInner{i, -i, i * 0.5};
+    }
+    auto writer = std::make_shared<TLVWriter>(SerializedSize(src, rules));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer->clear();
+        StructFieldsConvert(src, writer, rules);
+        benchmark::DoNotOptimize(writer->data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer->size()));
+}
+BENCHMARK(BM_SubStructTLV);
+
+// 嵌套子结构体：写入器位于栈上并以引用传入，作为 shared_ptr 接口的对照
+static void BM_SubStructTLVStackWriter(benchmark::State& state)
+{
+    auto innerRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x21),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x22),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x23)
+    );
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<1>(), 0x12, innerRules),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<2>(), 0x13, innerRules)
+    );
+    BenchNested src{};
+    src.id = 7;
+    for (int32_t i = 0; i < 16; ++i) {
+        src.innerArray[i] = BenchInner{i, -i, i * 0.5};
+    }
+    TLVWriter writer(SerializedSize(src, rules));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.clear();
+        StructFieldsConvert(src, writer, rules);
+        benchmark::DoNotOptimize(writer.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer.size()));
+}
+BENCHMARK(BM_SubStructTLVStackWriter);
+
+// 每条消息新建写入器，作为对象池的对照
+static void BM_TLVWriterPerMessage(benchmark::State& state)
+{
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x12),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<4>(), 0x13)
+    );
+    BenchFlat src = MakeBenchFlat();
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        auto writer = std::make_shared<TLVWriter>(256);
+        StructFieldsConvert(src, writer, rules);
+        benchmark::DoNotOptimize(writer->data());
+    }
+}
+BENCHMARK(BM_TLVWriterPerMessage);
+
+// 每条消息从线程本地对象池取出写入器，稳态下 allocs/op 为 0
+static void BM_TLVWriterPool(benchmark::State& state)
+{
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x12),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<4>(), 0x13)
+    );
+    BenchFlat src = MakeBenchFlat();
+    TLVWriterPool& pool = TLVWriterPool::ThreadLocal();
+    pool.Acquire(256);
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        PooledTLVWriter writer = pool.Acquire(256);
+        StructFieldsConvert(src, *writer, rules);
+        benchmark::DoNotOptimize(writer->data());
+    }
+}
+BENCHMARK(BM_TLVWriterPool);
+
+// 结构体数组批量编码到连续输出，第二个参数为线程数，按墙钟时间统计
+static void BM_TLVParallel(benchmark::State& state)
+{
+    auto innerRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x21),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x22),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x23)
+    );
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x12),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<4>(), 0x13),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<6>(), 0x14, innerRules)
+    );
+    std::vector<BenchFlat> src(static_cast<size_t>(state.range(0)), MakeBenchFlat());
+    size_t threadCount = static_cast<size_t>(state.range(1));
+    std::vector<uint8_t> out;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        out.clear();
+        StructFieldsConvertParallel(src.data(), src.size(), rules, out, threadCount);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * out.size()));
+}
+BENCHMARK(BM_TLVParallel)->Args({1 << 16, 1})->Args({1 << 16, 4})->UseRealTime();
+
+// 可变长数组：每个元素一条记录
+static void BM_VariableLengthArrayTLV(benchmark::State& state)
+{
+    auto rules = MakeMappingRuleTuple(MAKE_TLV_VARIABLE_LENGTH_ARRAY_MAPPING(MakeFieldPath<>(), 0, 1, 0x31));
+    std::unique_ptr<BenchArray> src(new BenchArray{});
+    src->length = static_cast<uint32_t>(state.range(0));
+    for (uint32_t i = 0; i < src->length; ++i) {
+        src->data[i] = static_cast<int32_t>(i);
+    }
+    auto writer = std::make_shared<TLVWriter>(SerializedSize(*src, rules));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer->clear();
+        StructFieldsConvert(*src, writer, rules);
+        benchmark::DoNotOptimize(writer->data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer->size()));
+}
+BENCHMARK(BM_VariableLengthArrayTLV)->Arg(16)->Arg(256)->Arg(1024);
+
+// 可变长数组：打包为一条记录
+static void BM_PackedArrayTLV(benchmark::State& state)
+{
+    auto rules = MakeMappingRuleTuple(MAKE_TLV_PACKED_ARRAY_MAPPING(MakeFieldPath<>(), 0, 1, 0x31));
+    std::unique_ptr<BenchArray> src(new BenchArray{});
+    src->length = static_cast<uint32_t>(state.range(0));
+    for (uint32_t i = 0; i < src->length; ++i) {
+        src->data[i] = static_cast<int32_t>(i);
+    }
+    auto writer = std::make_shared<TLVWriter>(SerializedSize(*src, rules));
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer->clear();
+        StructFieldsConvert(*src, writer, rules);
+        benchmark::DoNotOptimize(writer->data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * writer->size()));
+}
+BENCHMARK(BM_PackedArrayTLV)->Arg(16)->Arg(256)->Arg(1024);
+
+// JsonWriter：构建文档并序列化为字符串
+static void BM_JsonWriter(benchmark::State& state)
+{
+    BenchFlat src = MakeBenchFlat();
+    size_t outputBytes = 0;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        yyjson_mut_doc* doc = yyjson_mut_doc_new(&COUNTING_ALC);
+        {
+            JsonWriter writer(doc);
+            writer.SetObjectAsRoot(0);
+            writer.AddValueToCurrentObject("id", src.id);
+            writer.AddValueToCurrentObject("flags", src.flags);
+            writer.AddValueToCurrentObject("timestamp", src.timestamp);
+            writer.AddValueToCurrentObject("ratio", src.ratio);
+            writer.AddValueToCurrentObject("value", src.value);
+            writer.AddValueToCurrentObject("channel", src.channel);
+            yyjson_mut_val* inner = writer.AddObjectToCurrentObject("inner");
+            writer.AddValueToObject("a", src.inner.a, inner);
+            writer.AddValueToObject("b", src.inner.b, inner);
+            writer.AddValueToObject("c", src.inner.c, inner);
+
+            size_t len = 0;
+            char* json = yyjson_mut_write_opts(doc, YYJSON_WRITE_NOFLAG, &COUNTING_ALC, &len, nullptr);
+            benchmark::DoNotOptimize(json);
+            outputBytes += len;
+            COUNTING_ALC.free(COUNTING_ALC.ctx, json);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(outputBytes));
+}
+BENCHMARK(BM_JsonWriter);
+
+// JsonWriter + 动态内存池：每次迭代 Reset 复用文档内存，输出缓冲区同样从内存池申请
+// 内存池直接调用 malloc，不经过 COUNTING_ALC，因此 allocs/op 只反映 operator new
+static void BM_JsonWriter_Arena(benchmark::State& state)
+{
+    BenchFlat src = MakeBenchFlat();
+    JsonWriter writer;
+    size_t outputBytes = 0;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.Reset();
+        writer.SetObjectAsRoot(0);
+        writer.AddValueToCurrentObject("id", src.id);
+        writer.AddValueToCurrentObject("flags", src.flags);
+        writer.AddValueToCurrentObject("timestamp", src.timestamp);
+        writer.AddValueToCurrentObject("ratio", src.ratio);
+        writer.AddValueToCurrentObject("value", src.value);
+        writer.AddValueToCurrentObject("channel", src.channel);
+        yyjson_mut_val* inner = writer.AddObjectToCurrentObject("inner");
+        writer.AddValueToObject("a", src.inner.a, inner);
+        writer.AddValueToObject("b", src.inner.b, inner);
+        writer.AddValueToObject("c", src.inner.c, inner);
+
+        const yyjson_alc* alc = &writer.GetDoc()->alc;
+        size_t len = 0;
+        char* json = yyjson_mut_write_opts(writer.GetDoc(), YYJSON_WRITE_NOFLAG, alc, &len, nullptr);
+        benchmark::DoNotOptimize(json);
+        outputBytes += len;
+        alc->free(alc->ctx, json);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(outputBytes));
+}
+BENCHMARK(BM_JsonWriter_Arena);
+
+// ToJson：按字段名自动构建文档并序列化为字符串
+static void BM_ToJson(benchmark::State& state)
+{
+    BenchFlat src = MakeBenchFlat();
+    size_t outputBytes = 0;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        yyjson_mut_doc* doc = ToJson(src, &COUNTING_ALC);
+        size_t len = 0;
+        char* json = yyjson_mut_write_opts(doc, YYJSON_WRITE_NOFLAG, &COUNTING_ALC, &len, nullptr);
+        benchmark::DoNotOptimize(json);
+        outputBytes += len;
+        COUNTING_ALC.free(COUNTING_ALC.ctx, json);
+        yyjson_mut_doc_free(doc);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(outputBytes));
+}
+BENCHMARK(BM_ToJson);
+
+// JsonWriter 数值数组：可变长数组通过 yyjson_mut_arr_with_sint32 一次性构建
+static void BM_JsonWriter_NumericArray(benchmark::State& state)
+{
+    std::unique_ptr<BenchArray> src(new BenchArray{});
+    src->length = static_cast<uint32_t>(state.range(0));
+    for (uint32_t i = 0; i < src->length; ++i) {
+        src->data[i] = static_cast<int32_t>(i);
+    }
+    JsonWriter writer;
+    std::string json;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.Reset();
+        writer.ValueAsRoot(MakeVariableLengthArray(src->length, src->data));
+        writer.Serialize(json);
+        benchmark::DoNotOptimize(json.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * json.size()));
+}
+BENCHMARK(BM_JsonWriter_NumericArray)->Arg(16)->Arg(256)->Arg(1024);
+
+// JsonTextWriter：不构建 DOM，字段前缀为编译期常量，缓冲区跨迭代复用
+static void BM_JsonTextWriter(benchmark::State& state)
+{
+    BenchFlat src = MakeBenchFlat();
+    JsonTextWriter writer(256);
+    size_t outputBytes = 0;
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        writer.clear();
+        writer.Write(src);
+        benchmark::DoNotOptimize(writer.data());
+        outputBytes += writer.size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(outputBytes));
+}
+BENCHMARK(BM_JsonTextWriter);
+
+// FromJson：解析 JSON 文本并按字段名分发写入结构体
+static void BM_FromJson(benchmark::State& state)
+{
+    yyjson_mut_doc* doc = ToJson(MakeBenchFlat());
+    size_t len = 0;
+    char* json = yyjson_mut_write(doc, YYJSON_WRITE_NOFLAG, &len);
+    yyjson_mut_doc_free(doc);
+    BenchFlat dst{};
+    AllocationCounter counter(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(FromJson(json, len, dst, &COUNTING_ALC));
+        benchmark::DoNotOptimize(dst);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * len));
+    free(json);
+}
+BENCHMARK(BM_FromJson);
+
+BENCHMARK_MAIN();
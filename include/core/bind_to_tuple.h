@@ -10,7 +10,7 @@ namespace csrl {
 template <typename T, std::size_t... is>
 auto MakeViewImpl(T& t, std::index_sequence<is...>)
 {
-    return std::make_tuple(&std::get<is>(t)...);
+    return std::make_tuple(&csrl::Get<is>(t)...);
 }
 
 // N > 0 的通用模板定义
@@ -4,70 +4,430 @@
 #include <string>
 #include <utility> 
 #include <cstddef> 
+#include <type_traits>
+#include "define_type_traits.h"
+#include "string_literal.h"
 
 // 连接两个预处理器符号
 #define PP_CAT(A, B) PP_CAT_I(A, B)
 #define PP_CAT_I(A, B) A##B
 
-// 获取可变参数宏中的参数数量 (这里支持最多16个字段，可以扩展)
+// 获取可变参数宏中的参数数量 (这里支持最多128个字段)
 // 注意：每个 ((Type, Name)) 对被视为一个参数
 #define PP_NARG(...) PP_NARG_I(__VA_ARGS__, PP_RSEQ_N())
 #define PP_NARG_I(...) PP_ARG_N(__VA_ARGS__)
-#define PP_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
-#define PP_RSEQ_N() 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+#define PP_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21,       \
+    _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43,      \
+    _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65,      \
+    _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87,      \
+    _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107,        \
+    _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125,        \
+    _126, _127, _128, N, ...) N
+#define PP_RSEQ_N() 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111,          \
+    110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87,         \
+    86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60,        \
+    59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,        \
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,      \
+    3, 2, 1, 0
 
 // 预处理器迭代宏 (对每个字段应用一个宏)
 // M: 要应用的宏 (它应该接受 INDEX, STRUCT_NAME, FIELD_PAIR 作为参数)
 // STRUCT_NAME: 结构体名称
+// INDEX: 当前字段的下标，每展开一层通过 PP_INC 加一
 // ...: 字段对列表，例如 ((int, x)), ((double, y))
-#define PP_FOR_EACH_I_0(M, STRUCT_NAME)
-#define PP_FOR_EACH_I_1(M, STRUCT_NAME, F0) M(0, STRUCT_NAME, F0)
-#define PP_FOR_EACH_I_2(M, STRUCT_NAME, F0, F1) PP_FOR_EACH_I_1(M, STRUCT_NAME, F0) M(1, STRUCT_NAME, F1)
-#define PP_FOR_EACH_I_3(M, STRUCT_NAME, F0, F1, F2) PP_FOR_EACH_I_2(M, STRUCT_NAME, F0, F1) M(2, STRUCT_NAME, F2)
+// 每一层只处理首个字段并把其余字段交给下一层，宏定义的规模随字段数线性增长
+#define PP_FOR_EACH_I_0(M, STRUCT_NAME, INDEX)
+#define PP_FOR_EACH_I_1(M, STRUCT_NAME, INDEX, F) M(INDEX, STRUCT_NAME, F)
+#define PP_FOR_EACH_I_2(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_1(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_3(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_2(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_4(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_3(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_5(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_4(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_6(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_5(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_7(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_6(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_8(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_7(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_9(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_8(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_10(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_9(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_11(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_10(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_12(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_11(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_13(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_12(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_14(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_13(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_15(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_14(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_16(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_15(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_17(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_16(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_18(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_17(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_19(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_18(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_20(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_19(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_21(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_20(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_22(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_21(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_23(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_22(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_24(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_23(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_25(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_24(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_26(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_25(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_27(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_26(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_28(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_27(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_29(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_28(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_30(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_29(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_31(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_30(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_32(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_31(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_33(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_32(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_34(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_33(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_35(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_34(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_36(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_35(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_37(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_36(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_38(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_37(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_39(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_38(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_40(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_39(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_41(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_40(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_42(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_41(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_43(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_42(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_44(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_43(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_45(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_44(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_46(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_45(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_47(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_46(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_48(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_47(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_49(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_48(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_50(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_49(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_51(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_50(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_52(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_51(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_53(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_52(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_54(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_53(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_55(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_54(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_56(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_55(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_57(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_56(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_58(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_57(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_59(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_58(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_60(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_59(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_61(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_60(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_62(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_61(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_63(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_62(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_64(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_63(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_65(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_64(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_66(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_65(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_67(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_66(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_68(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_67(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_69(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_68(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_70(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_69(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_71(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_70(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_72(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_71(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_73(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_72(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_74(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_73(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_75(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_74(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_76(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_75(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_77(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_76(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_78(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_77(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_79(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_78(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_80(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_79(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_81(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_80(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_82(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_81(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_83(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_82(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_84(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_83(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_85(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_84(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_86(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_85(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_87(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_86(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_88(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_87(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_89(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_88(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_90(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_89(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_91(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_90(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_92(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_91(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_93(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_92(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_94(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_93(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_95(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_94(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_96(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_95(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_97(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_96(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_98(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_97(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_99(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_98(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_100(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_99(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_101(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_100(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_102(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_101(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_103(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_102(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_104(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_103(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_105(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_104(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_106(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_105(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_107(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_106(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_108(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_107(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_109(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_108(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_110(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_109(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_111(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_110(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_112(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_111(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_113(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_112(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_114(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_113(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_115(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_114(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_116(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_115(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_117(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_116(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_118(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_117(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_119(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_118(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_120(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_119(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_121(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_120(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_122(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_121(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_123(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_122(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_124(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_123(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_125(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_124(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_126(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_125(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_127(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_126(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
+#define PP_FOR_EACH_I_128(M, STRUCT_NAME, INDEX, F, ...) \
+    M(INDEX, STRUCT_NAME, F) PP_FOR_EACH_I_127(M, STRUCT_NAME, PP_INC(INDEX), __VA_ARGS__)
 
-#define PP_FOR_EACH_I_4(M, STRUCT_NAME, F0, F1, F2, F3)                                                                \
-    PP_FOR_EACH_I_3(M, STRUCT_NAME, F0, F1, F2) M(3, STRUCT_NAME, F3)
-
-#define PP_FOR_EACH_I_5(M, STRUCT_NAME, F0, F1, F2, F3, F4)                                                            \
-    PP_FOR_EACH_I_4(M, STRUCT_NAME, F0, F1, F2, F3) M(4, STRUCT_NAME, F4)
-
-#define PP_FOR_EACH_I_6(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5)                                                        \
-    PP_FOR_EACH_I_5(M, STRUCT_NAME, F0, F1, F2, F3, F4) M(5, STRUCT_NAME, F5)
-
-#define PP_FOR_EACH_I_7(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6)                                                    \
-    PP_FOR_EACH_I_6(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5) M(6, STRUCT_NAME, F6)
-
-#define PP_FOR_EACH_I_8(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7)                                                \
-    PP_FOR_EACH_I_7(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6) M(7, STRUCT_NAME, F7)
-
-#define PP_FOR_EACH_I_9(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8)                                            \
-    PP_FOR_EACH_I_8(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7) M(8, STRUCT_NAME, F8)
-
-#define PP_FOR_EACH_I_10(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9)                                       \
-    PP_FOR_EACH_I_9(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8) M(9, STRUCT_NAME, F9)
-
-#define PP_FOR_EACH_I_11(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10)                                  \
-    PP_FOR_EACH_I_10(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9) M(10, STRUCT_NAME, F10)
-
-#define PP_FOR_EACH_I_12(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11)                             \
-    PP_FOR_EACH_I_11(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10) M(11, STRUCT_NAME, F11)
-
-#define PP_FOR_EACH_I_13(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12)                        \
-    PP_FOR_EACH_I_12(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11) M(12, STRUCT_NAME, F12)
-
-#define PP_FOR_EACH_I_14(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12, F13)                   \
-    PP_FOR_EACH_I_13(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12) M(13, STRUCT_NAME, F13)
-
-#define PP_FOR_EACH_I_15(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12, F13, F14)              \
-    PP_FOR_EACH_I_14(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12, F13)                       \
-        M(14, STRUCT_NAME, F14)
-
-#define PP_FOR_EACH_I_16(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12, F13, F14, F15)         \
-    PP_FOR_EACH_I_15(M, STRUCT_NAME, F0, F1, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12, F13, F14)                  \
-        M(15, STRUCT_NAME, F15)
+// 编译期下标加一，供 PP_FOR_EACH_I_* 生成字面量下标
+// 不复用 PP_CAT：PP_FOR_EACH_I_* 由 PP_CAT 拼接得到，在其展开过程中 PP_CAT 不能再次展开
+#define PP_INC(N) PP_INC_I(N)
+#define PP_INC_I(N) PP_INC_##N
+#define PP_INC_0 1
+#define PP_INC_1 2
+#define PP_INC_2 3
+#define PP_INC_3 4
+#define PP_INC_4 5
+#define PP_INC_5 6
+#define PP_INC_6 7
+#define PP_INC_7 8
+#define PP_INC_8 9
+#define PP_INC_9 10
+#define PP_INC_10 11
+#define PP_INC_11 12
+#define PP_INC_12 13
+#define PP_INC_13 14
+#define PP_INC_14 15
+#define PP_INC_15 16
+#define PP_INC_16 17
+#define PP_INC_17 18
+#define PP_INC_18 19
+#define PP_INC_19 20
+#define PP_INC_20 21
+#define PP_INC_21 22
+#define PP_INC_22 23
+#define PP_INC_23 24
+#define PP_INC_24 25
+#define PP_INC_25 26
+#define PP_INC_26 27
+#define PP_INC_27 28
+#define PP_INC_28 29
+#define PP_INC_29 30
+#define PP_INC_30 31
+#define PP_INC_31 32
+#define PP_INC_32 33
+#define PP_INC_33 34
+#define PP_INC_34 35
+#define PP_INC_35 36
+#define PP_INC_36 37
+#define PP_INC_37 38
+#define PP_INC_38 39
+#define PP_INC_39 40
+#define PP_INC_40 41
+#define PP_INC_41 42
+#define PP_INC_42 43
+#define PP_INC_43 44
+#define PP_INC_44 45
+#define PP_INC_45 46
+#define PP_INC_46 47
+#define PP_INC_47 48
+#define PP_INC_48 49
+#define PP_INC_49 50
+#define PP_INC_50 51
+#define PP_INC_51 52
+#define PP_INC_52 53
+#define PP_INC_53 54
+#define PP_INC_54 55
+#define PP_INC_55 56
+#define PP_INC_56 57
+#define PP_INC_57 58
+#define PP_INC_58 59
+#define PP_INC_59 60
+#define PP_INC_60 61
+#define PP_INC_61 62
+#define PP_INC_62 63
+#define PP_INC_63 64
+#define PP_INC_64 65
+#define PP_INC_65 66
+#define PP_INC_66 67
+#define PP_INC_67 68
+#define PP_INC_68 69
+#define PP_INC_69 70
+#define PP_INC_70 71
+#define PP_INC_71 72
+#define PP_INC_72 73
+#define PP_INC_73 74
+#define PP_INC_74 75
+#define PP_INC_75 76
+#define PP_INC_76 77
+#define PP_INC_77 78
+#define PP_INC_78 79
+#define PP_INC_79 80
+#define PP_INC_80 81
+#define PP_INC_81 82
+#define PP_INC_82 83
+#define PP_INC_83 84
+#define PP_INC_84 85
+#define PP_INC_85 86
+#define PP_INC_86 87
+#define PP_INC_87 88
+#define PP_INC_88 89
+#define PP_INC_89 90
+#define PP_INC_90 91
+#define PP_INC_91 92
+#define PP_INC_92 93
+#define PP_INC_93 94
+#define PP_INC_94 95
+#define PP_INC_95 96
+#define PP_INC_96 97
+#define PP_INC_97 98
+#define PP_INC_98 99
+#define PP_INC_99 100
+#define PP_INC_100 101
+#define PP_INC_101 102
+#define PP_INC_102 103
+#define PP_INC_103 104
+#define PP_INC_104 105
+#define PP_INC_105 106
+#define PP_INC_106 107
+#define PP_INC_107 108
+#define PP_INC_108 109
+#define PP_INC_109 110
+#define PP_INC_110 111
+#define PP_INC_111 112
+#define PP_INC_112 113
+#define PP_INC_113 114
+#define PP_INC_114 115
+#define PP_INC_115 116
+#define PP_INC_116 117
+#define PP_INC_117 118
+#define PP_INC_118 119
+#define PP_INC_119 120
+#define PP_INC_120 121
+#define PP_INC_121 122
+#define PP_INC_122 123
+#define PP_INC_123 124
+#define PP_INC_124 125
+#define PP_INC_125 126
+#define PP_INC_126 127
+#define PP_INC_127 128
 
 #define EXPAND_ARGS_AS_FOR_EACH(STRUCT_NAME, MACRO_TO_APPLY, ...)                                                      \
-    PP_CAT(PP_FOR_EACH_I_, PP_NARG(__VA_ARGS__))(MACRO_TO_APPLY, STRUCT_NAME, __VA_ARGS__)
+    PP_CAT(PP_FOR_EACH_I_, PP_NARG(__VA_ARGS__))(MACRO_TO_APPLY, STRUCT_NAME, 0, __VA_ARGS__)
 
 // 从 ((Type, Name)) 中提取 Type 和 Name
 #define FIELD_PAIR_GET_TYPE_IMPL(TYPE, NAME) TYPE
@@ -108,13 +468,27 @@
 namespace csrl {
     template<typename StructType, std::size_t Index>
     struct FieldNameGetter;
+
+    // 结构体的字段个数：默认取 std::tuple_size，get_field_names.h 中的普通聚合类型单独特化
+    // 普通聚合类型不能特化 std::tuple_size，否则结构化绑定会改用 get<I>，而其 get<I> 正是基于结构化绑定实现的
+    template <typename T, typename = void>
+    struct FieldCount {};
+
+    template <typename T>
+    struct FieldCount<T, void_t<decltype(std::tuple_size<T>::value)>>
+        : std::integral_constant<std::size_t, std::tuple_size<T>::value> {};
 }
 
-// 生成字段名获取器的宏
+// 生成字段名获取器的宏，字段名、长度及其 StringLiteral 均可在编译期获取
 #define GEN_FIELD_NAME_GETTER(INDEX, STRUCT_NAME, FIELD_PAIR)                                                          \
     template <>                                                                                                        \
     struct csrl::FieldNameGetter<STRUCT_NAME, INDEX> {                                                                 \
-        static const char* Get() { return STRINGIFY_FIELD_NAME(FIELD_PAIR); }                                          \
+        static constexpr const char* Get() { return STRINGIFY_FIELD_NAME(FIELD_PAIR); }                                \
+        static constexpr std::size_t Length() { return sizeof(STRINGIFY_FIELD_NAME(FIELD_PAIR)) - 1; }                \
+        static constexpr csrl::StringLiteral<sizeof(STRINGIFY_FIELD_NAME(FIELD_PAIR))> Literal()                       \
+        {                                                                                                              \
+            return csrl::make_string_literal(STRINGIFY_FIELD_NAME(FIELD_PAIR));                                        \
+        }                                                                                                              \
     };
 
 namespace std {
@@ -122,6 +496,25 @@ namespace std {
     decltype(auto) get(T& obj);
 }
 
+namespace csrl {
+    // 字段访问的定制点：默认转发到 std::get（std::tuple 及 DEFINE_STRUCT_WITH_TUPLE_INTERFACE 生成的特化），
+    // get_field_names.h 中的普通聚合类型单独特化为结构化绑定访问。库内部统一通过 csrl::Get<I> 访问字段
+    template <typename T, typename = void>
+    struct FieldAccessor {
+        template <std::size_t I, typename U>
+        static decltype(auto) Get(U& obj)
+        {
+            return std::get<I>(obj);
+        }
+    };
+
+    template <std::size_t I, typename T>
+    decltype(auto) Get(T& obj)
+    {
+        return FieldAccessor<std::remove_const_t<T>>::template Get<I>(obj);
+    }
+}
+
 // 定义结构体并为其实现元组接口
 #define DEFINE_STRUCT_WITH_TUPLE_INTERFACE(STRUCT_NAME, ...)                                                           \
     struct STRUCT_NAME                                                                                                 \
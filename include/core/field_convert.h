@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
 #include "field_access.h"
 #include "field_mapping.h"
 #include "define_tuple_interface.h"
+#include "parallel_chunks.h"
 
 namespace csrl {
 template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I> 
@@ -20,10 +25,233 @@ void ConvertAllFields(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& ma
     (void)dummy; // 避免未使用变量警告
 }
 
+// 判断映射规则能否按位拷贝：一层路径的默认规则，源字段与目标字段类型相同且可平凡拷贝
+// 数组不能通过默认规则赋值，这里同样排除
+template <typename Rule, typename SrcStruct, typename DstStruct>
+struct MemcpyFieldRule {
+    static constexpr bool value = false;
+    static constexpr std::size_t srcIndex = 0;
+    static constexpr std::size_t dstIndex = 0;
+};
+
+template <std::size_t SrcIndex, std::size_t DstIndex, typename SrcStruct, typename DstStruct>
+struct MemcpyFieldRule<FieldMappingRule<FieldPath<SrcIndex>, FieldPath<DstIndex>, void>, SrcStruct, DstStruct> {
+    using SrcField = remove_cvref_t<decltype(csrl::Get<SrcIndex>(std::declval<SrcStruct&>()))>;
+    using DstField = remove_cvref_t<decltype(csrl::Get<DstIndex>(std::declval<DstStruct&>()))>;
+
+    static constexpr bool value = std::is_same<SrcField, DstField>::value &&
+        std::is_trivially_copyable<SrcField>::value && !std::is_array<SrcField>::value;
+    static constexpr std::size_t srcIndex = SrcIndex;
+    static constexpr std::size_t dstIndex = DstIndex;
+};
+
+// 第 I 个映射规则的按位拷贝属性，越界时视为不可拷贝
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I,
+          bool = (I < MappingRuleTuple::size)>
+struct MemcpyRuleAt
+    : MemcpyFieldRule<std::tuple_element_t<I, decltype(std::declval<MappingRuleTuple>().mappings)>, SrcStruct, DstStruct> {
+};
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I>
+struct MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I, false> : MemcpyFieldRule<void, SrcStruct, DstStruct> {};
+
+// 从第 I 个映射规则开始，连续的可按位拷贝且源、目标字段下标同时递增的规则个数
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I,
+          bool = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I>::value>
+struct MemcpyRunLength : std::integral_constant<std::size_t, 0> {};
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I>
+struct MemcpyRunLength<SrcStruct, DstStruct, MappingRuleTuple, I, true> {
+    using Current = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I>;
+    using Next = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I + 1>;
+
+    static constexpr bool continued =
+        Next::value && Next::srcIndex == Current::srcIndex + 1 && Next::dstIndex == Current::dstIndex + 1;
+    static constexpr std::size_t value =
+        1 + (continued ? MemcpyRunLength<SrcStruct, DstStruct, MappingRuleTuple, I + 1>::value : 0);
+};
+
+template <typename Field>
+const char* FieldAddress(Field& field)
+{
+    return reinterpret_cast<const char*>(std::addressof(field));
+}
+
+// 一段连续字段在源、目标结构体中的相对偏移是否一致（对齐与填充可能不同）
+// 偏移在编译期已确定，开启优化后整个判断被常量折叠
+template <std::size_t SrcBase, std::size_t DstBase, typename SrcStruct, typename DstStruct, std::size_t... K>
+bool SameFieldsLayout(SrcStruct& src, DstStruct& dst, std::index_sequence<K...>)
+{
+    const char* srcBase = FieldAddress(csrl::Get<SrcBase>(src));
+    const char* dstBase = FieldAddress(csrl::Get<DstBase>(dst));
+    bool same = true;
+    int dummy[] = {0, (same = same && FieldAddress(csrl::Get<SrcBase + K>(src)) - srcBase ==
+                                          FieldAddress(csrl::Get<DstBase + K>(dst)) - dstBase, 0)...};
+    (void)dummy; // 避免未使用变量警告
+    return same;
+}
+
+// 逐条执行第 I 个映射规则开始的 N 个规则
+template <std::size_t I, typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t... K>
+void ConvertFieldsInOrder(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& mappingRuleTuple,
+                          std::index_sequence<K...>)
+{
+    int dummy[] = {0, (SingleFieldConvert<SrcStruct, DstStruct, MappingRuleTuple, I + K>(src, dst, mappingRuleTuple), 0)...};
+    (void)dummy; // 避免未使用变量警告
+}
+
+// 按映射规则顺序转换：连续的同类型字段合并为一次 memcpy，其余规则逐条执行
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I,
+          bool = (I < MappingRuleTuple::size)>
+struct FieldsConvertPlan {
+    static constexpr std::size_t runLength = MemcpyRunLength<SrcStruct, DstStruct, MappingRuleTuple, I>::value;
+    static constexpr std::size_t step = runLength > 1 ? runLength : 1;
+
+    static void Convert(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& mappingRuleTuple)
+    {
+        ConvertRun(src, dst, mappingRuleTuple, std::integral_constant<bool, (runLength > 1)>{});
+        FieldsConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, I + step>::Convert(src, dst, mappingRuleTuple);
+    }
+
+    static void ConvertRun(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& mappingRuleTuple, std::false_type)
+    {
+        SingleFieldConvert<SrcStruct, DstStruct, MappingRuleTuple, I>(src, dst, mappingRuleTuple);
+    }
+
+    // 拷贝范围从第一个字段的起始地址到最后一个字段的结束地址，字段间的填充字节一并拷贝；
+    // 源与目标可能是同一对象，拷贝范围会重叠，因此使用 memmove
+    static void ConvertRun(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& mappingRuleTuple, std::true_type)
+    {
+        using First = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I>;
+        using Last = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I + runLength - 1>;
+        if (!SameFieldsLayout<First::srcIndex, First::dstIndex>(src, dst, std::make_index_sequence<runLength>{})) {
+            ConvertFieldsInOrder<I>(src, dst, mappingRuleTuple, std::make_index_sequence<runLength>{});
+            return;
+        }
+        const char* srcBegin = FieldAddress(csrl::Get<First::srcIndex>(src));
+        const char* srcEnd = FieldAddress(csrl::Get<Last::srcIndex>(src)) + sizeof(typename Last::SrcField);
+        void* dstBegin = const_cast<char*>(FieldAddress(csrl::Get<First::dstIndex>(dst)));
+        memmove(dstBegin, srcBegin, static_cast<std::size_t>(srcEnd - srcBegin));
+    }
+};
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I>
+struct FieldsConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, I, false> {
+    static void Convert(SrcStruct&, DstStruct&, const MappingRuleTuple&) {}
+};
+
 // 主转换器
 template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple>
 void StructFieldsConvert(SrcStruct& src, DstStruct& dst, const MappingRuleTuple& mappingRuleTuple)
 {
-    ConvertAllFields(src, dst, mappingRuleTuple, std::make_index_sequence<MappingRuleTuple::size>{});
+    FieldsConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, 0>::Convert(src, dst, mappingRuleTuple);
+}
+
+// 每个线程至少处理的元素个数，元素过少时创建线程的开销超过转换本身
+constexpr std::size_t BATCH_MIN_ELEMENTS_PER_THREAD = 4096;
+
+// 批量转换的分块元素个数：分块内的源、目标元素在多次遍历期间保持在缓存中
+constexpr std::size_t BATCH_TILE_ELEMENTS = 64;
+
+// 从第 I 个映射规则开始，连续的不能合并为按位拷贝段的规则个数
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I,
+          bool = (I < MappingRuleTuple::size) &&
+                 (MemcpyRunLength<SrcStruct, DstStruct, MappingRuleTuple, I>::value <= 1)>
+struct ElementwiseRuleCount : std::integral_constant<std::size_t, 0> {};
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I>
+struct ElementwiseRuleCount<SrcStruct, DstStruct, MappingRuleTuple, I, true>
+    : std::integral_constant<std::size_t,
+                             1 + ElementwiseRuleCount<SrcStruct, DstStruct, MappingRuleTuple, I + 1>::value> {};
+
+// 批量转换的执行计划：规则分组与 FieldsConvertPlan 相同，按位拷贝段在外层、元素在内层遍历，
+// 布局判断与拷贝范围对整个分块只计算一次；相邻的其余规则仍按元素依次执行，
+// 结构体数组中同一字段的地址不连续，逐条规则遍历这些字段无法向量化且需要多次遍历分块。
+// 每个元素上规则的执行顺序与 StructFieldsConvert 相同
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I,
+          bool = (I < MappingRuleTuple::size)>
+struct FieldsBatchConvertPlan {
+    static constexpr std::size_t runLength = MemcpyRunLength<SrcStruct, DstStruct, MappingRuleTuple, I>::value;
+    static constexpr std::size_t step =
+        runLength > 1 ? runLength : ElementwiseRuleCount<SrcStruct, DstStruct, MappingRuleTuple, I>::value;
+
+    static void Convert(SrcStruct* src, DstStruct* dst, std::size_t count, const MappingRuleTuple& mappingRuleTuple)
+    {
+        ConvertStep(src, dst, count, mappingRuleTuple, std::integral_constant<bool, (runLength > 1)>{});
+        FieldsBatchConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, I + step>::Convert(src, dst, count,
+                                                                                          mappingRuleTuple);
+    }
+
+    static void ConvertStep(SrcStruct* src, DstStruct* dst, std::size_t count, const MappingRuleTuple& mappingRuleTuple,
+                            std::false_type)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            ConvertFieldsInOrder<I>(src[i], dst[i], mappingRuleTuple, std::make_index_sequence<step>{});
+        }
+    }
+
+    // 字段偏移对所有元素相同，在第一个元素上确定后每个元素一次定长拷贝；
+    // 拷贝段覆盖整个结构体且两侧大小相同时，整个分块合并为一次拷贝。源与目标数组可能重叠，使用 memmove
+    static void ConvertStep(SrcStruct* src, DstStruct* dst, std::size_t count, const MappingRuleTuple& mappingRuleTuple,
+                            std::true_type)
+    {
+        using First = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I>;
+        using Last = MemcpyRuleAt<SrcStruct, DstStruct, MappingRuleTuple, I + runLength - 1>;
+        if (!SameFieldsLayout<First::srcIndex, First::dstIndex>(src[0], dst[0], std::make_index_sequence<runLength>{})) {
+            for (std::size_t i = 0; i < count; ++i) {
+                ConvertFieldsInOrder<I>(src[i], dst[i], mappingRuleTuple, std::make_index_sequence<runLength>{});
+            }
+            return;
+        }
+        const char* srcBegin = FieldAddress(csrl::Get<First::srcIndex>(src[0]));
+        const char* srcEnd = FieldAddress(csrl::Get<Last::srcIndex>(src[0])) + sizeof(typename Last::SrcField);
+        const std::size_t srcOffset = static_cast<std::size_t>(srcBegin - FieldAddress(src[0]));
+        const std::size_t dstOffset =
+            static_cast<std::size_t>(FieldAddress(csrl::Get<First::dstIndex>(dst[0])) - FieldAddress(dst[0]));
+        const std::size_t length = static_cast<std::size_t>(srcEnd - srcBegin);
+        if (srcOffset == 0 && dstOffset == 0 && length == sizeof(SrcStruct) && sizeof(SrcStruct) == sizeof(DstStruct)) {
+            memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * length);
+            return;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            memmove(const_cast<char*>(FieldAddress(dst[i])) + dstOffset, FieldAddress(src[i]) + srcOffset, length);
+        }
+    }
+};
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple, std::size_t I>
+struct FieldsBatchConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, I, false> {
+    static void Convert(SrcStruct*, DstStruct*, std::size_t, const MappingRuleTuple&) {}
+};
+
+// 批量转换 src[0..count) 到 dst[0..count)，结果与逐个调用 StructFieldsConvert 相同
+// 按 BATCH_TILE_ELEMENTS 个元素分块执行 FieldsBatchConvertPlan
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple>
+void StructFieldsConvertBatch(SrcStruct* src, DstStruct* dst, std::size_t count, const MappingRuleTuple& mappingRuleTuple)
+{
+    for (std::size_t begin = 0; begin < count; begin += BATCH_TILE_ELEMENTS) {
+        FieldsBatchConvertPlan<SrcStruct, DstStruct, MappingRuleTuple, 0>::Convert(
+            src + begin, dst + begin, std::min(BATCH_TILE_ELEMENTS, count - begin), mappingRuleTuple);
+    }
+}
+
+// 将批量转换按元素切分到 threadCount 个线程（含调用线程）中执行，各线程读写互不重叠的元素区间
+// 映射规则被多个线程同时调用，自定义转换器需要是无状态或线程安全的
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple>
+void StructFieldsConvertBatch(SrcStruct* src, DstStruct* dst, std::size_t count, const MappingRuleTuple& mappingRuleTuple,
+                              std::size_t threadCount)
+{
+    ChunkPlan plan(count, threadCount, BATCH_MIN_ELEMENTS_PER_THREAD);
+    RunChunksInParallel(plan, [&](size_t /*chunkIndex*/, size_t begin, size_t len) {
+        StructFieldsConvertBatch(src + begin, dst + begin, len, mappingRuleTuple);
+    });
+}
+
+template <typename SrcStruct, typename DstStruct, typename MappingRuleTuple>
+void StructFieldsConvertBatch(const std::vector<SrcStruct>& src, std::vector<DstStruct>& dst,
+                              const MappingRuleTuple& mappingRuleTuple, std::size_t threadCount = 1)
+{
+    dst.resize(src.size());
+    StructFieldsConvertBatch(src.data(), dst.data(), src.size(), mappingRuleTuple, threadCount);
 }
 } // namespace csrl
\ No newline at end of file
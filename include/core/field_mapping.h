@@ -5,6 +5,7 @@
 #include <type_traits>
 #include <functional>
 #include <cstring>
+#include "define_tuple_interface.h"
 #include "define_type_traits.h"
 
 namespace csrl {
@@ -51,7 +52,7 @@ template<std::size_t FirstIndex, std::size_t... RestIndexs>
 struct PathAccessor {
     template<typename S>
     static decltype(auto) GetField(S& s) {
-        return PathAccessor<RestIndexs...>::GetField(std::get<FirstIndex>(s));
+        return PathAccessor<RestIndexs...>::GetField(csrl::Get<FirstIndex>(s));
     }
 };
 
@@ -60,7 +61,7 @@ template<std::size_t LastIndex>
 struct PathAccessor<LastIndex> {
     template<typename S>
     static decltype(auto) GetField(S& s) {
-        return std::get<LastIndex>(s);
+        return csrl::Get<LastIndex>(s);
     }
 };
 
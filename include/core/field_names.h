@@ -0,0 +1,119 @@
+/**
+ * @file field_names.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 元组接口结构体的编译期字段名表，以及基于完美哈希的字段名 → 字段下标查找
+ * @version 0.1
+ * @date 2025-09-06
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "define_tuple_interface.h"
+#include "perfect_hash.h"
+
+namespace csrl {
+
+// 编译期计算字段名的 FNV-1a 哈希
+constexpr uint32_t FieldNameHash(const char* key, size_t len)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(key[i])) * 16777619u;
+    }
+    return hash;
+}
+
+// memcmp 不能用于常量表达式，这里逐字节比较
+constexpr bool FieldNameEquals(const char* lhs, const char* rhs, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 编译期生成的字段名表：
+// m_names/m_lengths 按字段下标排列，可用于常量表达式；Literals() 返回各字段名的 StringLiteral
+// Find 按字段名的哈希定位字段下标，命中后再比较一次字段名
+// 优先使用完美哈希，找不到时退化为 2 倍容量的线性探测表
+template <typename T, typename IndexSequence = std::make_index_sequence<FieldCount<T>::value>>
+struct FieldNames;
+
+template <typename T, size_t... I>
+struct FieldNames<T, std::index_sequence<I...>> {
+    static constexpr size_t m_count = sizeof...(I);
+    static constexpr const char* m_names[m_count + 1] = {FieldNameGetter<T, I>::Get()..., nullptr};
+    static constexpr size_t m_lengths[m_count + 1] = {FieldNameGetter<T, I>::Length()..., 0};
+    static constexpr uint32_t m_hashes[m_count + 1] = {
+        FieldNameHash(FieldNameGetter<T, I>::Get(), FieldNameGetter<T, I>::Length())..., 0};
+    static constexpr size_t m_perfectModulus = FindPerfectHashModulus<8 * m_count + 8>(m_hashes, m_count, false);
+    static constexpr bool m_perfect = (m_perfectModulus != 0);
+    static constexpr size_t m_modulus = m_perfect ? m_perfectModulus : 2 * m_count + 1;
+    static constexpr PerfectHashSlots<m_modulus> m_table = BuildPerfectHashSlots<m_modulus>(m_hashes, m_count, false);
+
+    static constexpr std::tuple<decltype(FieldNameGetter<T, I>::Literal())...> Literals()
+    {
+        return std::tuple<decltype(FieldNameGetter<T, I>::Literal())...>(FieldNameGetter<T, I>::Literal()...);
+    }
+
+    // 返回字段名对应的字段下标，未找到时返回 m_count
+    static constexpr size_t Find(const char* key, size_t len)
+    {
+        size_t pos = FieldNameHash(key, len) % m_modulus;
+        for (size_t probe = 0; probe < m_modulus; ++probe) {
+            uint32_t slot = m_table.m_slots[pos];
+            if (slot == PERFECT_HASH_EMPTY_SLOT) {
+                return m_count;
+            }
+            if (m_lengths[slot] == len && FieldNameEquals(m_names[slot], key, len)) {
+                return slot;
+            }
+            if (m_perfect) {
+                return m_count;
+            }
+            pos = (pos + 1) % m_modulus;
+        }
+        return m_count;
+    }
+};
+
+template <typename T, size_t... I>
+constexpr size_t FieldNames<T, std::index_sequence<I...>>::m_count;
+
+template <typename T, size_t... I>
+constexpr const char* FieldNames<T, std::index_sequence<I...>>::m_names[];
+
+template <typename T, size_t... I>
+constexpr size_t FieldNames<T, std::index_sequence<I...>>::m_lengths[];
+
+template <typename T, size_t... I>
+constexpr uint32_t FieldNames<T, std::index_sequence<I...>>::m_hashes[];
+
+template <typename T, size_t... I>
+constexpr PerfectHashSlots<FieldNames<T, std::index_sequence<I...>>::m_modulus>
+    FieldNames<T, std::index_sequence<I...>>::m_table;
+
+// 字段名 → 字段下标，未找到时返回字段个数；参数为常量时可在编译期求值
+template <typename T>
+constexpr size_t FieldIndexOf(const char* name, size_t len)
+{
+    return FieldNames<T>::Find(name, len);
+}
+
+template <typename T, size_t N>
+constexpr size_t FieldIndexOf(const char (&name)[N])
+{
+    return FieldNames<T>::Find(name, N - 1);
+}
+
+} // namespace csrl
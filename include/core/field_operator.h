@@ -2,6 +2,7 @@
 
 #include <type_traits>
 #include <iostream>
+#include "define_tuple_interface.h"
 #include "define_type_traits.h"
 
 namespace csrl {
@@ -42,12 +43,12 @@ public:
     }
 };
 
-// 检测类型是否支持 tuple_size（即是否为结构化类型）
+// 检测类型是否支持 FieldCount（即是否为结构化类型）
 template<typename T>
 struct has_tuple_size {
 private:
     template<typename U>
-    static auto test(int) -> decltype(std::tuple_size<remove_cvref_t<U>>::value, std::true_type{});
+    static auto test(int) -> decltype(FieldCount<remove_cvref_t<U>>::value, std::true_type{});
     template<typename>
     static std::false_type test(...);
 public:
@@ -70,7 +71,7 @@ void VisitFieldsHelper(T& field, Visitor&& visitor, std::false_type) {}
 template<typename T, std::size_t I, std::size_t N, typename Visitor>
 struct FieldVisitor {
     static void Visit(T& obj, Visitor&& visitor) {
-        auto &field = std::get<I>(obj);
+        auto &field = csrl::Get<I>(obj);
         constexpr bool isSubStruct = has_tuple_size<decltype(field)>::value;
         visitor(field, isSubStruct);
         VisitFieldsHelper(field, std::forward<Visitor>(visitor), 
@@ -91,7 +92,7 @@ template<typename T, typename Visitor>
 typename std::enable_if<has_tuple_size<T>::value>::type
 VisitFields(T& obj, Visitor&& visitor)
 {
-    constexpr std::size_t size = std::tuple_size<T>::value;
+    constexpr std::size_t size = FieldCount<T>::value;
     FieldVisitor<T, 0, size, Visitor>::Visit(obj, std::forward<Visitor>(visitor));
 }
 }
\ No newline at end of file
@@ -1,33 +1,426 @@
 /*
- * @Description: 在编译时从C++结构体中获取字段名
+ * @Description: 在编译时从普通聚合类型中获取字段及字段名
+ *
+ * 不使用 DEFINE_STRUCT_WITH_TUPLE_INTERFACE 的聚合类型（例如已有的协议头文件）可以通过
+ * DEFINE_TUPLE_INTERFACE_FOR_AGGREGATE(StructName) 获得与其一致的元组接口，从而直接用于 JSON 与 TLV 转换：
+ * - C++17：通过 FieldsCounts 统计字段数（csrl::FieldCount），通过结构化绑定实现 std::tuple_element/csrl::Get
+ * - C++20：额外通过 __PRETTY_FUNCTION__ 在编译期提取字段名，实现 FieldNameGetter
+ * 全部在编译期完成，运行期与手写的成员访问相同
+ *
+ * 限制：字段数不超过 128；不支持 C 风格数组成员（聚合初始化的大括号省略会导致字段数统计错误），
+ * 请使用 std::array 替代；不支持带基类的聚合类型
  */
 
 #pragma once
 #pragma GCC system_header
 
+#include <cstddef>
 #include <tuple>
-#include <string>
 #include <type_traits>
+#include <utility>
+#include "define_tuple_interface.h"
 #include "define_type_traits.h"
+#include "fields.h"
 #include "string_literal.h"
 
-#if 0
+#if __cplusplus >= 201703L
+
+#if __cplusplus >= 202002L
+#include <string_view>
+#endif
+
+// 结构化绑定的名字列表：AGGREGATE_BINDINGS_3 展开为 f0, f1, f2
+#define AGGREGATE_BINDINGS_1 f0
+#define AGGREGATE_BINDINGS_2 AGGREGATE_BINDINGS_1, f1
+#define AGGREGATE_BINDINGS_3 AGGREGATE_BINDINGS_2, f2
+#define AGGREGATE_BINDINGS_4 AGGREGATE_BINDINGS_3, f3
+#define AGGREGATE_BINDINGS_5 AGGREGATE_BINDINGS_4, f4
+#define AGGREGATE_BINDINGS_6 AGGREGATE_BINDINGS_5, f5
+#define AGGREGATE_BINDINGS_7 AGGREGATE_BINDINGS_6, f6
+#define AGGREGATE_BINDINGS_8 AGGREGATE_BINDINGS_7, f7
+#define AGGREGATE_BINDINGS_9 AGGREGATE_BINDINGS_8, f8
+#define AGGREGATE_BINDINGS_10 AGGREGATE_BINDINGS_9, f9
+#define AGGREGATE_BINDINGS_11 AGGREGATE_BINDINGS_10, f10
+#define AGGREGATE_BINDINGS_12 AGGREGATE_BINDINGS_11, f11
+#define AGGREGATE_BINDINGS_13 AGGREGATE_BINDINGS_12, f12
+#define AGGREGATE_BINDINGS_14 AGGREGATE_BINDINGS_13, f13
+#define AGGREGATE_BINDINGS_15 AGGREGATE_BINDINGS_14, f14
+#define AGGREGATE_BINDINGS_16 AGGREGATE_BINDINGS_15, f15
+#define AGGREGATE_BINDINGS_17 AGGREGATE_BINDINGS_16, f16
+#define AGGREGATE_BINDINGS_18 AGGREGATE_BINDINGS_17, f17
+#define AGGREGATE_BINDINGS_19 AGGREGATE_BINDINGS_18, f18
+#define AGGREGATE_BINDINGS_20 AGGREGATE_BINDINGS_19, f19
+#define AGGREGATE_BINDINGS_21 AGGREGATE_BINDINGS_20, f20
+#define AGGREGATE_BINDINGS_22 AGGREGATE_BINDINGS_21, f21
+#define AGGREGATE_BINDINGS_23 AGGREGATE_BINDINGS_22, f22
+#define AGGREGATE_BINDINGS_24 AGGREGATE_BINDINGS_23, f23
+#define AGGREGATE_BINDINGS_25 AGGREGATE_BINDINGS_24, f24
+#define AGGREGATE_BINDINGS_26 AGGREGATE_BINDINGS_25, f25
+#define AGGREGATE_BINDINGS_27 AGGREGATE_BINDINGS_26, f26
+#define AGGREGATE_BINDINGS_28 AGGREGATE_BINDINGS_27, f27
+#define AGGREGATE_BINDINGS_29 AGGREGATE_BINDINGS_28, f28
+#define AGGREGATE_BINDINGS_30 AGGREGATE_BINDINGS_29, f29
+#define AGGREGATE_BINDINGS_31 AGGREGATE_BINDINGS_30, f30
+#define AGGREGATE_BINDINGS_32 AGGREGATE_BINDINGS_31, f31
+#define AGGREGATE_BINDINGS_33 AGGREGATE_BINDINGS_32, f32
+#define AGGREGATE_BINDINGS_34 AGGREGATE_BINDINGS_33, f33
+#define AGGREGATE_BINDINGS_35 AGGREGATE_BINDINGS_34, f34
+#define AGGREGATE_BINDINGS_36 AGGREGATE_BINDINGS_35, f35
+#define AGGREGATE_BINDINGS_37 AGGREGATE_BINDINGS_36, f36
+#define AGGREGATE_BINDINGS_38 AGGREGATE_BINDINGS_37, f37
+#define AGGREGATE_BINDINGS_39 AGGREGATE_BINDINGS_38, f38
+#define AGGREGATE_BINDINGS_40 AGGREGATE_BINDINGS_39, f39
+#define AGGREGATE_BINDINGS_41 AGGREGATE_BINDINGS_40, f40
+#define AGGREGATE_BINDINGS_42 AGGREGATE_BINDINGS_41, f41
+#define AGGREGATE_BINDINGS_43 AGGREGATE_BINDINGS_42, f42
+#define AGGREGATE_BINDINGS_44 AGGREGATE_BINDINGS_43, f43
+#define AGGREGATE_BINDINGS_45 AGGREGATE_BINDINGS_44, f44
+#define AGGREGATE_BINDINGS_46 AGGREGATE_BINDINGS_45, f45
+#define AGGREGATE_BINDINGS_47 AGGREGATE_BINDINGS_46, f46
+#define AGGREGATE_BINDINGS_48 AGGREGATE_BINDINGS_47, f47
+#define AGGREGATE_BINDINGS_49 AGGREGATE_BINDINGS_48, f48
+#define AGGREGATE_BINDINGS_50 AGGREGATE_BINDINGS_49, f49
+#define AGGREGATE_BINDINGS_51 AGGREGATE_BINDINGS_50, f50
+#define AGGREGATE_BINDINGS_52 AGGREGATE_BINDINGS_51, f51
+#define AGGREGATE_BINDINGS_53 AGGREGATE_BINDINGS_52, f52
+#define AGGREGATE_BINDINGS_54 AGGREGATE_BINDINGS_53, f53
+#define AGGREGATE_BINDINGS_55 AGGREGATE_BINDINGS_54, f54
+#define AGGREGATE_BINDINGS_56 AGGREGATE_BINDINGS_55, f55
+#define AGGREGATE_BINDINGS_57 AGGREGATE_BINDINGS_56, f56
+#define AGGREGATE_BINDINGS_58 AGGREGATE_BINDINGS_57, f57
+#define AGGREGATE_BINDINGS_59 AGGREGATE_BINDINGS_58, f58
+#define AGGREGATE_BINDINGS_60 AGGREGATE_BINDINGS_59, f59
+#define AGGREGATE_BINDINGS_61 AGGREGATE_BINDINGS_60, f60
+#define AGGREGATE_BINDINGS_62 AGGREGATE_BINDINGS_61, f61
+#define AGGREGATE_BINDINGS_63 AGGREGATE_BINDINGS_62, f62
+#define AGGREGATE_BINDINGS_64 AGGREGATE_BINDINGS_63, f63
+#define AGGREGATE_BINDINGS_65 AGGREGATE_BINDINGS_64, f64
+#define AGGREGATE_BINDINGS_66 AGGREGATE_BINDINGS_65, f65
+#define AGGREGATE_BINDINGS_67 AGGREGATE_BINDINGS_66, f66
+#define AGGREGATE_BINDINGS_68 AGGREGATE_BINDINGS_67, f67
+#define AGGREGATE_BINDINGS_69 AGGREGATE_BINDINGS_68, f68
+#define AGGREGATE_BINDINGS_70 AGGREGATE_BINDINGS_69, f69
+#define AGGREGATE_BINDINGS_71 AGGREGATE_BINDINGS_70, f70
+#define AGGREGATE_BINDINGS_72 AGGREGATE_BINDINGS_71, f71
+#define AGGREGATE_BINDINGS_73 AGGREGATE_BINDINGS_72, f72
+#define AGGREGATE_BINDINGS_74 AGGREGATE_BINDINGS_73, f73
+#define AGGREGATE_BINDINGS_75 AGGREGATE_BINDINGS_74, f74
+#define AGGREGATE_BINDINGS_76 AGGREGATE_BINDINGS_75, f75
+#define AGGREGATE_BINDINGS_77 AGGREGATE_BINDINGS_76, f76
+#define AGGREGATE_BINDINGS_78 AGGREGATE_BINDINGS_77, f77
+#define AGGREGATE_BINDINGS_79 AGGREGATE_BINDINGS_78, f78
+#define AGGREGATE_BINDINGS_80 AGGREGATE_BINDINGS_79, f79
+#define AGGREGATE_BINDINGS_81 AGGREGATE_BINDINGS_80, f80
+#define AGGREGATE_BINDINGS_82 AGGREGATE_BINDINGS_81, f81
+#define AGGREGATE_BINDINGS_83 AGGREGATE_BINDINGS_82, f82
+#define AGGREGATE_BINDINGS_84 AGGREGATE_BINDINGS_83, f83
+#define AGGREGATE_BINDINGS_85 AGGREGATE_BINDINGS_84, f84
+#define AGGREGATE_BINDINGS_86 AGGREGATE_BINDINGS_85, f85
+#define AGGREGATE_BINDINGS_87 AGGREGATE_BINDINGS_86, f86
+#define AGGREGATE_BINDINGS_88 AGGREGATE_BINDINGS_87, f87
+#define AGGREGATE_BINDINGS_89 AGGREGATE_BINDINGS_88, f88
+#define AGGREGATE_BINDINGS_90 AGGREGATE_BINDINGS_89, f89
+#define AGGREGATE_BINDINGS_91 AGGREGATE_BINDINGS_90, f90
+#define AGGREGATE_BINDINGS_92 AGGREGATE_BINDINGS_91, f91
+#define AGGREGATE_BINDINGS_93 AGGREGATE_BINDINGS_92, f92
+#define AGGREGATE_BINDINGS_94 AGGREGATE_BINDINGS_93, f93
+#define AGGREGATE_BINDINGS_95 AGGREGATE_BINDINGS_94, f94
+#define AGGREGATE_BINDINGS_96 AGGREGATE_BINDINGS_95, f95
+#define AGGREGATE_BINDINGS_97 AGGREGATE_BINDINGS_96, f96
+#define AGGREGATE_BINDINGS_98 AGGREGATE_BINDINGS_97, f97
+#define AGGREGATE_BINDINGS_99 AGGREGATE_BINDINGS_98, f98
+#define AGGREGATE_BINDINGS_100 AGGREGATE_BINDINGS_99, f99
+#define AGGREGATE_BINDINGS_101 AGGREGATE_BINDINGS_100, f100
+#define AGGREGATE_BINDINGS_102 AGGREGATE_BINDINGS_101, f101
+#define AGGREGATE_BINDINGS_103 AGGREGATE_BINDINGS_102, f102
+#define AGGREGATE_BINDINGS_104 AGGREGATE_BINDINGS_103, f103
+#define AGGREGATE_BINDINGS_105 AGGREGATE_BINDINGS_104, f104
+#define AGGREGATE_BINDINGS_106 AGGREGATE_BINDINGS_105, f105
+#define AGGREGATE_BINDINGS_107 AGGREGATE_BINDINGS_106, f106
+#define AGGREGATE_BINDINGS_108 AGGREGATE_BINDINGS_107, f107
+#define AGGREGATE_BINDINGS_109 AGGREGATE_BINDINGS_108, f108
+#define AGGREGATE_BINDINGS_110 AGGREGATE_BINDINGS_109, f109
+#define AGGREGATE_BINDINGS_111 AGGREGATE_BINDINGS_110, f110
+#define AGGREGATE_BINDINGS_112 AGGREGATE_BINDINGS_111, f111
+#define AGGREGATE_BINDINGS_113 AGGREGATE_BINDINGS_112, f112
+#define AGGREGATE_BINDINGS_114 AGGREGATE_BINDINGS_113, f113
+#define AGGREGATE_BINDINGS_115 AGGREGATE_BINDINGS_114, f114
+#define AGGREGATE_BINDINGS_116 AGGREGATE_BINDINGS_115, f115
+#define AGGREGATE_BINDINGS_117 AGGREGATE_BINDINGS_116, f116
+#define AGGREGATE_BINDINGS_118 AGGREGATE_BINDINGS_117, f117
+#define AGGREGATE_BINDINGS_119 AGGREGATE_BINDINGS_118, f118
+#define AGGREGATE_BINDINGS_120 AGGREGATE_BINDINGS_119, f119
+#define AGGREGATE_BINDINGS_121 AGGREGATE_BINDINGS_120, f120
+#define AGGREGATE_BINDINGS_122 AGGREGATE_BINDINGS_121, f121
+#define AGGREGATE_BINDINGS_123 AGGREGATE_BINDINGS_122, f122
+#define AGGREGATE_BINDINGS_124 AGGREGATE_BINDINGS_123, f123
+#define AGGREGATE_BINDINGS_125 AGGREGATE_BINDINGS_124, f124
+#define AGGREGATE_BINDINGS_126 AGGREGATE_BINDINGS_125, f125
+#define AGGREGATE_BINDINGS_127 AGGREGATE_BINDINGS_126, f126
+#define AGGREGATE_BINDINGS_128 AGGREGATE_BINDINGS_127, f127
+
 namespace csrl {
 
-template <class T>
-[[gnu::no_sanitize_undefined]]
-auto get_field_names() {
-  using Type = csrl::remove_cvref_t<T>;
-  if constexpr (std::is_pointer_v<Type>) {
-    return get_field_names<std::remove_pointer_t<T>>();
-  } else {
-    const auto get = []<std::size_t... _is>(std::index_sequence<_is...>) {
-      return concat_literals(
-          get_field_name<Type, get_ith_field_from_fake_object<T, _is>()>()...);
+template <std::size_t N>
+struct AggregateTieHelper;
+
+template <>
+struct AggregateTieHelper<0> {
+    template <typename T>
+    static constexpr auto Tie(T&)
+    {
+        return std::tuple<>();
+    }
+};
+
+// 通过结构化绑定将 N 个字段绑定为引用元组
+#define DEFINE_AGGREGATE_TIE(N)                                                                                        \
+    template <>                                                                                                        \
+    struct AggregateTieHelper<N> {                                                                                     \
+        template <typename T>                                                                                          \
+        static constexpr auto Tie(T& value)                                                                            \
+        {                                                                                                              \
+            auto& [AGGREGATE_BINDINGS_##N] = value;                                                                    \
+            return std::tie(AGGREGATE_BINDINGS_##N);                                                                   \
+        }                                                                                                              \
     };
-    return get(std::make_index_sequence<num_fields<T>>());
-  }
+
+DEFINE_AGGREGATE_TIE(1)
+DEFINE_AGGREGATE_TIE(2)
+DEFINE_AGGREGATE_TIE(3)
+DEFINE_AGGREGATE_TIE(4)
+DEFINE_AGGREGATE_TIE(5)
+DEFINE_AGGREGATE_TIE(6)
+DEFINE_AGGREGATE_TIE(7)
+DEFINE_AGGREGATE_TIE(8)
+DEFINE_AGGREGATE_TIE(9)
+DEFINE_AGGREGATE_TIE(10)
+DEFINE_AGGREGATE_TIE(11)
+DEFINE_AGGREGATE_TIE(12)
+DEFINE_AGGREGATE_TIE(13)
+DEFINE_AGGREGATE_TIE(14)
+DEFINE_AGGREGATE_TIE(15)
+DEFINE_AGGREGATE_TIE(16)
+DEFINE_AGGREGATE_TIE(17)
+DEFINE_AGGREGATE_TIE(18)
+DEFINE_AGGREGATE_TIE(19)
+DEFINE_AGGREGATE_TIE(20)
+DEFINE_AGGREGATE_TIE(21)
+DEFINE_AGGREGATE_TIE(22)
+DEFINE_AGGREGATE_TIE(23)
+DEFINE_AGGREGATE_TIE(24)
+DEFINE_AGGREGATE_TIE(25)
+DEFINE_AGGREGATE_TIE(26)
+DEFINE_AGGREGATE_TIE(27)
+DEFINE_AGGREGATE_TIE(28)
+DEFINE_AGGREGATE_TIE(29)
+DEFINE_AGGREGATE_TIE(30)
+DEFINE_AGGREGATE_TIE(31)
+DEFINE_AGGREGATE_TIE(32)
+DEFINE_AGGREGATE_TIE(33)
+DEFINE_AGGREGATE_TIE(34)
+DEFINE_AGGREGATE_TIE(35)
+DEFINE_AGGREGATE_TIE(36)
+DEFINE_AGGREGATE_TIE(37)
+DEFINE_AGGREGATE_TIE(38)
+DEFINE_AGGREGATE_TIE(39)
+DEFINE_AGGREGATE_TIE(40)
+DEFINE_AGGREGATE_TIE(41)
+DEFINE_AGGREGATE_TIE(42)
+DEFINE_AGGREGATE_TIE(43)
+DEFINE_AGGREGATE_TIE(44)
+DEFINE_AGGREGATE_TIE(45)
+DEFINE_AGGREGATE_TIE(46)
+DEFINE_AGGREGATE_TIE(47)
+DEFINE_AGGREGATE_TIE(48)
+DEFINE_AGGREGATE_TIE(49)
+DEFINE_AGGREGATE_TIE(50)
+DEFINE_AGGREGATE_TIE(51)
+DEFINE_AGGREGATE_TIE(52)
+DEFINE_AGGREGATE_TIE(53)
+DEFINE_AGGREGATE_TIE(54)
+DEFINE_AGGREGATE_TIE(55)
+DEFINE_AGGREGATE_TIE(56)
+DEFINE_AGGREGATE_TIE(57)
+DEFINE_AGGREGATE_TIE(58)
+DEFINE_AGGREGATE_TIE(59)
+DEFINE_AGGREGATE_TIE(60)
+DEFINE_AGGREGATE_TIE(61)
+DEFINE_AGGREGATE_TIE(62)
+DEFINE_AGGREGATE_TIE(63)
+DEFINE_AGGREGATE_TIE(64)
+DEFINE_AGGREGATE_TIE(65)
+DEFINE_AGGREGATE_TIE(66)
+DEFINE_AGGREGATE_TIE(67)
+DEFINE_AGGREGATE_TIE(68)
+DEFINE_AGGREGATE_TIE(69)
+DEFINE_AGGREGATE_TIE(70)
+DEFINE_AGGREGATE_TIE(71)
+DEFINE_AGGREGATE_TIE(72)
+DEFINE_AGGREGATE_TIE(73)
+DEFINE_AGGREGATE_TIE(74)
+DEFINE_AGGREGATE_TIE(75)
+DEFINE_AGGREGATE_TIE(76)
+DEFINE_AGGREGATE_TIE(77)
+DEFINE_AGGREGATE_TIE(78)
+DEFINE_AGGREGATE_TIE(79)
+DEFINE_AGGREGATE_TIE(80)
+DEFINE_AGGREGATE_TIE(81)
+DEFINE_AGGREGATE_TIE(82)
+DEFINE_AGGREGATE_TIE(83)
+DEFINE_AGGREGATE_TIE(84)
+DEFINE_AGGREGATE_TIE(85)
+DEFINE_AGGREGATE_TIE(86)
+DEFINE_AGGREGATE_TIE(87)
+DEFINE_AGGREGATE_TIE(88)
+DEFINE_AGGREGATE_TIE(89)
+DEFINE_AGGREGATE_TIE(90)
+DEFINE_AGGREGATE_TIE(91)
+DEFINE_AGGREGATE_TIE(92)
+DEFINE_AGGREGATE_TIE(93)
+DEFINE_AGGREGATE_TIE(94)
+DEFINE_AGGREGATE_TIE(95)
+DEFINE_AGGREGATE_TIE(96)
+DEFINE_AGGREGATE_TIE(97)
+DEFINE_AGGREGATE_TIE(98)
+DEFINE_AGGREGATE_TIE(99)
+DEFINE_AGGREGATE_TIE(100)
+DEFINE_AGGREGATE_TIE(101)
+DEFINE_AGGREGATE_TIE(102)
+DEFINE_AGGREGATE_TIE(103)
+DEFINE_AGGREGATE_TIE(104)
+DEFINE_AGGREGATE_TIE(105)
+DEFINE_AGGREGATE_TIE(106)
+DEFINE_AGGREGATE_TIE(107)
+DEFINE_AGGREGATE_TIE(108)
+DEFINE_AGGREGATE_TIE(109)
+DEFINE_AGGREGATE_TIE(110)
+DEFINE_AGGREGATE_TIE(111)
+DEFINE_AGGREGATE_TIE(112)
+DEFINE_AGGREGATE_TIE(113)
+DEFINE_AGGREGATE_TIE(114)
+DEFINE_AGGREGATE_TIE(115)
+DEFINE_AGGREGATE_TIE(116)
+DEFINE_AGGREGATE_TIE(117)
+DEFINE_AGGREGATE_TIE(118)
+DEFINE_AGGREGATE_TIE(119)
+DEFINE_AGGREGATE_TIE(120)
+DEFINE_AGGREGATE_TIE(121)
+DEFINE_AGGREGATE_TIE(122)
+DEFINE_AGGREGATE_TIE(123)
+DEFINE_AGGREGATE_TIE(124)
+DEFINE_AGGREGATE_TIE(125)
+DEFINE_AGGREGATE_TIE(126)
+DEFINE_AGGREGATE_TIE(127)
+DEFINE_AGGREGATE_TIE(128)
+
+#undef DEFINE_AGGREGATE_TIE
+
+// 返回由聚合类型各字段引用组成的元组
+template <typename T>
+constexpr auto AggregateTie(T& value)
+{
+    return AggregateTieHelper<FieldsCounts<std::remove_cv_t<T>>>::Tie(value);
 }
 
-}  
-#endif
\ No newline at end of file
+template <typename T, std::size_t I>
+using AggregateFieldType = std::remove_reference_t<decltype(std::get<I>(AggregateTie(std::declval<T&>())))>;
+
+#if __cplusplus >= 202002L
+
+// 只声明不定义的对象，仅用于在常量表达式中取得字段地址，不会被 odr 使用
+template <typename T>
+struct AggregateFakeObject {
+    const T m_value;
+};
+
+template <typename T>
+extern const AggregateFakeObject<T> AGGREGATE_FAKE_OBJECT;
+
+// 以字段地址作为模板参数，函数签名中会包含字段名，例如：
+// GCC:   ... [with auto FieldPtr = (& csrl::AGGREGATE_FAKE_OBJECT<Person>.csrl::AggregateFakeObject<Person>::m_value.Person::age)]
+// Clang: ... [FieldPtr = &csrl::AGGREGATE_FAKE_OBJECT<Person>.m_value.age]
+template <auto FieldPtr>
+constexpr std::string_view AggregateFieldSignature()
+{
+    return __PRETTY_FUNCTION__;
+}
+
+constexpr bool IsIdentifierChar(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_';
+}
+
+// 取 "FieldPtr = " 之后、第一个 ')'、']' 或 ';' 之前的最后一个标识符
+constexpr std::string_view ExtractAggregateFieldName(std::string_view signature)
+{
+    std::size_t start = signature.find("FieldPtr = ");
+    std::size_t end = signature.find_first_of(")];", start);
+    std::size_t begin = end;
+    while (begin > start && IsIdentifierChar(signature[begin - 1])) {
+        --begin;
+    }
+    return signature.substr(begin, end - begin);
+}
+
+template <std::size_t N>
+struct AggregateFieldNameChars {
+    char m_chars[N];
+};
+
+template <typename T, std::size_t I>
+struct AggregateFieldName {
+  private:
+    static constexpr std::string_view m_view = ExtractAggregateFieldName(
+        AggregateFieldSignature<&std::get<I>(AggregateTie(AGGREGATE_FAKE_OBJECT<T>.m_value))>());
+
+    template <std::size_t... Is>
+    static constexpr AggregateFieldNameChars<sizeof...(Is) + 1> ToChars(std::index_sequence<Is...>)
+    {
+        return {{m_view[Is]..., '\0'}};
+    }
+
+    static constexpr auto m_name = ToChars(std::make_index_sequence<m_view.size()>{});
+
+  public:
+    static constexpr const char* Get() { return m_name.m_chars; }
+    static constexpr std::size_t Length() { return m_view.size(); }
+    static constexpr StringLiteral<sizeof(m_name.m_chars)> Literal() { return make_string_literal(m_name.m_chars); }
+};
+
+#define DEFINE_AGGREGATE_FIELD_NAME_GETTER(STRUCT_NAME)                                                                \
+    template <std::size_t I>                                                                                           \
+    struct csrl::FieldNameGetter<STRUCT_NAME, I> : csrl::AggregateFieldName<STRUCT_NAME, I> {};
+
+#else
+
+// C++17 下无法取得字段名，只提供元组接口
+#define DEFINE_AGGREGATE_FIELD_NAME_GETTER(STRUCT_NAME)
+
+#endif
+
+} // namespace csrl
+
+// 为已定义的聚合类型实现元组接口（C++20 下同时实现 FieldNameGetter），需要在全局命名空间中使用
+// 字段个数通过 csrl::FieldCount 提供而不特化 std::tuple_size，以保证结构化绑定按数据成员展开
+#define DEFINE_TUPLE_INTERFACE_FOR_AGGREGATE(STRUCT_NAME)                                                              \
+    template <>                                                                                                        \
+    struct csrl::FieldCount<STRUCT_NAME, void>                                                                         \
+        : public std::integral_constant<std::size_t, csrl::FieldsCounts<STRUCT_NAME>> {};                              \
+    template <>                                                                                                        \
+    struct csrl::FieldAccessor<STRUCT_NAME, void> {                                                                    \
+        template <std::size_t I, typename U>                                                                           \
+        static decltype(auto) Get(U& obj)                                                                              \
+        {                                                                                                              \
+            return std::get<I>(csrl::AggregateTie(obj));                                                               \
+        }                                                                                                              \
+    };                                                                                                                 \
+    namespace std {                                                                                                    \
+        template <std::size_t I>                                                                                       \
+        struct tuple_element<I, STRUCT_NAME> {                                                                         \
+            using type = csrl::AggregateFieldType<STRUCT_NAME, I>;                                                     \
+        };                                                                                                             \
+    }                                                                                                                  \
+    DEFINE_AGGREGATE_FIELD_NAME_GETTER(STRUCT_NAME)
+
+#endif
@@ -0,0 +1,364 @@
+/**
+ * @file number_format.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 不分配内存的数字格式化工具，供 TLV 与 JSON 写入器共用
+ * @version 0.1
+ * @date 2025-08-23
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "yyjson.h"
+
+namespace csrl {
+
+// 数字格式化所需的栈缓冲区大小，可容纳 64 位整数以及 yyjson 输出的浮点数（含结尾的 '\0'）
+constexpr size_t NUMBER_BUFFER_SIZE = 40;
+
+// 最短往返格式的浮点数文本长度上限，yyjson 输出单个数字时最多使用 32 字节
+constexpr size_t FLOAT_TEXT_MAX_SIZE = 32;
+
+// 计算整数的十进制字符数（含负号）
+template<typename T>
+constexpr size_t DecimalDigitCount(T value)
+{
+    using UnsignedType = typename std::make_unsigned<T>::type;
+    size_t count = 1;
+    UnsignedType magnitude = static_cast<UnsignedType>(value);
+    if (value < 0) {
+        magnitude = static_cast<UnsignedType>(UnsignedType(0) - magnitude);
+        ++count;
+    }
+    while (magnitude >= 10) {
+        magnitude = static_cast<UnsignedType>(magnitude / 10);
+        ++count;
+    }
+    return count;
+}
+
+// 00~99 的两位十进制字符表，每次处理两位以减少除法次数
+inline const char* DecimalDigitPairs()
+{
+    static const char table[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    return table;
+}
+
+// 将整数格式化为十进制字符串，从 bufEnd 向前写入并返回起始位置，不分配内存
+template<typename T>
+char* FormatDecimal(T value, char* bufEnd)
+{
+    using UnsignedType = typename std::make_unsigned<T>::type;
+    UnsignedType magnitude = static_cast<UnsignedType>(value);
+    bool negative = value < 0;
+    if (negative) {
+        magnitude = static_cast<UnsignedType>(UnsignedType(0) - magnitude);
+    }
+
+    const char* pairs = DecimalDigitPairs();
+    char* pos = bufEnd;
+    while (magnitude >= 100) {
+        size_t index = static_cast<size_t>(magnitude % 100) * 2;
+        magnitude = static_cast<UnsignedType>(magnitude / 100);
+        *--pos = pairs[index + 1];
+        *--pos = pairs[index];
+    }
+    if (magnitude >= 10) {
+        size_t index = static_cast<size_t>(magnitude) * 2;
+        *--pos = pairs[index + 1];
+        *--pos = pairs[index];
+    } else {
+        *--pos = static_cast<char>('0' + magnitude);
+    }
+    if (negative) {
+        *--pos = '-';
+    }
+    return pos;
+}
+
+// yyjson 的分配器适配：唯一一次分配直接返回调用方提供的缓冲区（ctx），不访问堆
+struct NumberBufferAllocator {
+    static void* Malloc(void* ctx, size_t size) { return size <= NUMBER_BUFFER_SIZE ? ctx : nullptr; }
+    static void* Realloc(void* /*ctx*/, void* /*ptr*/, size_t /*oldSize*/, size_t /*size*/) { return nullptr; }
+    static void Free(void* /*ctx*/, void* /*ptr*/) {}
+};
+
+// 使用 yyjson 将 double 格式化为最短往返字符串，写入 buf（至少 NUMBER_BUFFER_SIZE 字节）并返回长度
+// flg 中的 YYJSON_WRITE_ALLOW_INF_AND_NAN 允许输出 NaN、Infinity；不允许时遇到 NaN 或无穷大返回 0
+inline size_t FormatShortest(double value, char* buf, yyjson_write_flag flg)
+{
+    yyjson_alc alc = {&NumberBufferAllocator::Malloc, &NumberBufferAllocator::Realloc, &NumberBufferAllocator::Free, buf};
+    yyjson_val number = {};
+    yyjson_set_real(&number, value);
+    size_t len = 0;
+    return yyjson_val_write_opts(&number, flg, &alc, &len, nullptr) == nullptr ? 0 : len;
+}
+
+// float 最短数字生成使用的定长无符号大整数（小端序 32 位分段）
+// float 的取值范围内，算法中出现的最大值小于 2^160，6 段足够
+class ShortestDigitsBigInt {
+public:
+    static constexpr size_t m_maxLimbs = 6;
+
+    explicit ShortestDigitsBigInt(uint32_t value = 0) : m_size(value == 0 ? 0 : 1) { m_limbs[0] = value; }
+
+    void ShiftLeft(uint32_t bits)
+    {
+        size_t limbShift = bits / 32;
+        uint32_t bitShift = bits % 32;
+        if (m_size == 0) {
+            return;
+        }
+        m_limbs[m_size] = 0;
+        for (size_t i = m_size + 1; i-- > 0;) {
+            uint32_t high = m_limbs[i] << bitShift;
+            uint32_t low = (bitShift != 0 && i > 0) ? m_limbs[i - 1] >> (32 - bitShift) : 0;
+            m_limbs[i + limbShift] = high | low;
+        }
+        for (size_t i = 0; i < limbShift; ++i) {
+            m_limbs[i] = 0;
+        }
+        m_size += limbShift + 1;
+        Trim();
+    }
+
+    void Multiply(uint32_t factor)
+    {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < m_size; ++i) {
+            uint64_t product = static_cast<uint64_t>(m_limbs[i]) * factor + carry;
+            m_limbs[i] = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+        if (carry != 0) {
+            m_limbs[m_size++] = static_cast<uint32_t>(carry);
+        }
+    }
+
+    void MultiplyPow10(uint32_t exponent)
+    {
+        for (; exponent >= 9; exponent -= 9) {
+            Multiply(1000000000u);
+        }
+        static const uint32_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+        Multiply(pow10[exponent]);
+    }
+
+    // 要求 *this >= other
+    void Subtract(const ShortestDigitsBigInt& other)
+    {
+        int64_t borrow = 0;
+        for (size_t i = 0; i < m_size; ++i) {
+            int64_t diff = static_cast<int64_t>(m_limbs[i]) - (i < other.m_size ? other.m_limbs[i] : 0) - borrow;
+            borrow = diff < 0 ? 1 : 0;
+            m_limbs[i] = static_cast<uint32_t>(diff + (borrow << 32));
+        }
+        Trim();
+    }
+
+    // 比较 a + b 与 c
+    static int CompareSum(const ShortestDigitsBigInt& a, const ShortestDigitsBigInt& b, const ShortestDigitsBigInt& c)
+    {
+        ShortestDigitsBigInt sum(a);
+        uint64_t carry = 0;
+        size_t size = std::max(a.m_size, b.m_size);
+        for (size_t i = 0; i < size; ++i) {
+            uint64_t value = static_cast<uint64_t>(i < a.m_size ? a.m_limbs[i] : 0) + (i < b.m_size ? b.m_limbs[i] : 0) + carry;
+            sum.m_limbs[i] = static_cast<uint32_t>(value);
+            carry = value >> 32;
+        }
+        sum.m_size = size;
+        if (carry != 0) {
+            sum.m_limbs[sum.m_size++] = static_cast<uint32_t>(carry);
+        }
+        return Compare(sum, c);
+    }
+
+    static int Compare(const ShortestDigitsBigInt& a, const ShortestDigitsBigInt& b)
+    {
+        if (a.m_size != b.m_size) {
+            return a.m_size < b.m_size ? -1 : 1;
+        }
+        for (size_t i = a.m_size; i-- > 0;) {
+            if (a.m_limbs[i] != b.m_limbs[i]) {
+                return a.m_limbs[i] < b.m_limbs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+private:
+    void Trim()
+    {
+        while (m_size > 0 && m_limbs[m_size - 1] == 0) {
+            --m_size;
+        }
+    }
+
+    uint32_t m_limbs[m_maxLimbs + 1] = {};
+    size_t m_size;
+};
+
+// 生成正有限 float 的最短往返十进制数字（Steele & White / Burger & Dybvig 的自由格式算法，大整数精确运算）：
+// 数字写入 digits（最多 9 位），返回位数；value = 0.d1d2...dn × 10^decimalPoint
+// 多个最短候选时取最接近原值的一个，与 strtof 的就近舍入（偶数优先）一致
+inline int ShortestFloatDigits(float value, char* digits, int& decimalPoint)
+{
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t significand = bits & 0x7FFFFFu;
+    int biasedExponent = static_cast<int>((bits >> 23) & 0xFFu);
+    int exponent = biasedExponent == 0 ? -149 : biasedExponent - 150;
+    if (biasedExponent != 0) {
+        significand |= 0x800000u;
+    }
+    bool even = (significand & 1u) == 0;
+    // 有效数为 2 的幂时与下一个较小值的间隔只有一半，下边界更近
+    bool unequalGaps = biasedExponent > 1 && significand == 0x800000u;
+
+    // value = r / s，舍入区间为 (r - mMinus, r + mPlus) / s，边界在有效数为偶数时可取到
+    ShortestDigitsBigInt r(significand);
+    ShortestDigitsBigInt s(1);
+    ShortestDigitsBigInt mPlus(1);
+    ShortestDigitsBigInt mMinus(1);
+    uint32_t gapShift = unequalGaps ? 2 : 1;
+    r.ShiftLeft(gapShift);
+    if (exponent >= 0) {
+        r.ShiftLeft(static_cast<uint32_t>(exponent));
+        mPlus.ShiftLeft(static_cast<uint32_t>(exponent) + gapShift - 1);
+        mMinus.ShiftLeft(static_cast<uint32_t>(exponent));
+        s.ShiftLeft(gapShift);
+    } else {
+        mPlus.ShiftLeft(gapShift - 1);
+        s.ShiftLeft(static_cast<uint32_t>(-exponent) + gapShift);
+    }
+
+    // 按二进制指数估算十进制指数（可能偏小），再逐次修正到上边界小于 10^k
+    int k = static_cast<int>(std::ceil(std::ilogb(value) * 0.30102999566398114 - 1e-10));
+    if (k >= 0) {
+        s.MultiplyPow10(static_cast<uint32_t>(k));
+    } else {
+        r.MultiplyPow10(static_cast<uint32_t>(-k));
+        mPlus.MultiplyPow10(static_cast<uint32_t>(-k));
+        mMinus.MultiplyPow10(static_cast<uint32_t>(-k));
+    }
+    while (ShortestDigitsBigInt::CompareSum(r, mPlus, s) >= (even ? 0 : 1)) {
+        s.Multiply(10);
+        ++k;
+    }
+    decimalPoint = k;
+
+    int count = 0;
+    while (true) {
+        r.Multiply(10);
+        mPlus.Multiply(10);
+        mMinus.Multiply(10);
+        int digit = 0;
+        while (ShortestDigitsBigInt::Compare(r, s) >= 0) {
+            r.Subtract(s);
+            ++digit;
+        }
+        int lowCompare = ShortestDigitsBigInt::Compare(r, mMinus);
+        int highCompare = ShortestDigitsBigInt::CompareSum(r, mPlus, s);
+        bool lowOk = even ? lowCompare <= 0 : lowCompare < 0;
+        bool highOk = even ? highCompare >= 0 : highCompare > 0;
+        if (!lowOk && !highOk) {
+            digits[count++] = static_cast<char>('0' + digit);
+            continue;
+        }
+        if (lowOk && highOk) {
+            // 两个候选都在区间内，取更接近原值的一个，距离相等时取偶数
+            int half = ShortestDigitsBigInt::CompareSum(r, r, s);
+            highOk = half > 0 || (half == 0 && (digit & 1) != 0);
+        }
+        digits[count++] = static_cast<char>('0' + digit + (highOk ? 1 : 0));
+        return count;
+    }
+}
+
+// float 的最短往返字符串：按 float 自身的精度生成最少的有效数字，而不是按 double 输出全部误差位
+// 输出格式与 yyjson 输出 double 时一致：指数在 (-6, 21] 内使用小数形式并保留小数点，否则使用科学计数法
+inline size_t FormatShortest(float value, char* buf, yyjson_write_flag flg)
+{
+    if (!std::isfinite(value)) {
+        return FormatShortest(static_cast<double>(value), buf, flg);
+    }
+    char* pos = buf;
+    if (std::signbit(value)) {
+        *pos++ = '-';
+    }
+    if (value == 0.0f) {
+        memcpy(pos, "0.0", 3);
+        return static_cast<size_t>(pos + 3 - buf);
+    }
+
+    char digits[std::numeric_limits<float>::max_digits10];
+    int decimalPoint = 0;
+    int count = ShortestFloatDigits(std::fabs(value), digits, decimalPoint);
+    if (decimalPoint > -6 && decimalPoint <= 21) {
+        if (decimalPoint <= 0) {
+            // 如 0.001234
+            *pos++ = '0';
+            *pos++ = '.';
+            for (int i = decimalPoint; i < 0; ++i) {
+                *pos++ = '0';
+            }
+            memcpy(pos, digits, static_cast<size_t>(count));
+            pos += count;
+        } else if (decimalPoint < count) {
+            // 如 12.34
+            memcpy(pos, digits, static_cast<size_t>(decimalPoint));
+            pos += decimalPoint;
+            *pos++ = '.';
+            memcpy(pos, digits + decimalPoint, static_cast<size_t>(count - decimalPoint));
+            pos += count - decimalPoint;
+        } else {
+            // 如 1234.0、1200000.0
+            memcpy(pos, digits, static_cast<size_t>(count));
+            pos += count;
+            for (int i = count; i < decimalPoint; ++i) {
+                *pos++ = '0';
+            }
+            *pos++ = '.';
+            *pos++ = '0';
+        }
+    } else {
+        // 如 1.234e-7、2e30
+        *pos++ = digits[0];
+        if (count > 1) {
+            *pos++ = '.';
+            memcpy(pos, digits + 1, static_cast<size_t>(count - 1));
+            pos += count - 1;
+        }
+        *pos++ = 'e';
+        char exponentText[4];
+        char* exponentBegin = FormatDecimal(decimalPoint - 1, exponentText + sizeof(exponentText));
+        size_t exponentLen = static_cast<size_t>(exponentText + sizeof(exponentText) - exponentBegin);
+        memcpy(pos, exponentBegin, exponentLen);
+        pos += exponentLen;
+    }
+    return static_cast<size_t>(pos - buf);
+}
+
+// long double 转换为 double 会丢失精度与范围，不提供格式化，避免静默截断
+size_t FormatShortest(long double value, char* buf, yyjson_write_flag flg) = delete;
+
+} // namespace csrl
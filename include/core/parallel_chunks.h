@@ -0,0 +1,69 @@
+/**
+ * @file parallel_chunks.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 将元素区间切分为连续的分块，并在多个线程中分别处理
+ * @version 0.1
+ * @date 2025-09-06
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace csrl {
+
+// 可同时运行的线程数，无法获取时视为 1
+inline size_t HardwareThreadCount()
+{
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// 将 [0, count) 切分为不超过 maxChunks 个连续分块，每个分块至少 minPerChunk 个元素（元素不足时只有一个分块）
+// 每个分块对应一个线程，分块数同时不超过 HardwareThreadCount()，避免线程数超过核数后互相争抢
+class ChunkPlan {
+public:
+    ChunkPlan(size_t count, size_t maxChunks, size_t minPerChunk) : m_count(count)
+    {
+        size_t limit = std::min(maxChunks, HardwareThreadCount());
+        size_t chunks = std::max<size_t>(1, std::min(limit, count / std::max<size_t>(minPerChunk, 1)));
+        m_chunkSize = std::max<size_t>(1, (count + chunks - 1) / chunks);
+        m_chunkCount = count == 0 ? 1 : (count + m_chunkSize - 1) / m_chunkSize;
+    }
+
+    size_t Count() const { return m_count; }
+    size_t ChunkCount() const { return m_chunkCount; }
+    size_t Begin(size_t index) const { return std::min(index * m_chunkSize, m_count); }
+    size_t Length(size_t index) const { return std::min(m_chunkSize, m_count - Begin(index)); }
+
+private:
+    size_t m_count;
+    size_t m_chunkSize;
+    size_t m_chunkCount;
+};
+
+// 并行执行 func(chunkIndex, begin, length)：第 0 个分块在调用线程中执行，其余分块各使用一个线程，全部完成后返回
+// 只有一个分块时直接在调用线程中执行，不创建线程也不分配内存
+template <typename Func>
+void RunChunksInParallel(const ChunkPlan& plan, const Func& func)
+{
+    if (plan.ChunkCount() == 1) {
+        func(size_t(0), plan.Begin(0), plan.Length(0));
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(plan.ChunkCount() - 1);
+    for (size_t i = 1; i < plan.ChunkCount(); ++i) {
+        workers.emplace_back([&plan, &func, i]() { func(i, plan.Begin(i), plan.Length(i)); });
+    }
+    func(size_t(0), plan.Begin(0), plan.Length(0));
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace csrl
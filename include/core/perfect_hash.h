@@ -0,0 +1,84 @@
+/**
+ * @file perfect_hash.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 编译期构造的 uint32_t 键 → 下标查找表，优先使用完美哈希，供 TLV type 分发与字段名查找共用
+ * @version 0.1
+ * @date 2025-09-06
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace csrl {
+
+constexpr uint32_t PERFECT_HASH_EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+// 判断第 i 个键是否与之前的键重复
+constexpr bool IsDuplicateHashKey(const uint32_t* keys, size_t i)
+{
+    for (size_t j = 0; j < i; ++j) {
+        if (keys[j] == keys[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 在 [count, limit) 中寻找使所有键取模后互不冲突的最小模数，找不到时返回 0
+// skipDuplicates 为 true 时相同的键只保留第一个（如重复的 TLV type），为 false 时相同的键视为冲突（如哈希相同的不同字段名）
+template <size_t limit>
+constexpr size_t FindPerfectHashModulus(const uint32_t* keys, size_t count, bool skipDuplicates)
+{
+    bool used[limit] = {};
+    for (size_t modulus = (count == 0 ? 1 : count); modulus < limit; ++modulus) {
+        for (size_t i = 0; i < modulus; ++i) {
+            used[i] = false;
+        }
+        bool perfect = true;
+        for (size_t i = 0; i < count && perfect; ++i) {
+            if (skipDuplicates && IsDuplicateHashKey(keys, i)) {
+                continue;
+            }
+            size_t pos = keys[i] % modulus;
+            perfect = !used[pos];
+            used[pos] = true;
+        }
+        if (perfect) {
+            return modulus;
+        }
+    }
+    return 0;
+}
+
+template <size_t modulus>
+struct PerfectHashSlots {
+    uint32_t m_slots[modulus];
+};
+
+// 以 key % modulus 为起点线性探测放置下标；完美哈希时不会发生探测
+template <size_t modulus>
+constexpr PerfectHashSlots<modulus> BuildPerfectHashSlots(const uint32_t* keys, size_t count, bool skipDuplicates)
+{
+    PerfectHashSlots<modulus> result{};
+    for (size_t i = 0; i < modulus; ++i) {
+        result.m_slots[i] = PERFECT_HASH_EMPTY_SLOT;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (skipDuplicates && IsDuplicateHashKey(keys, i)) {
+            continue;
+        }
+        size_t pos = keys[i] % modulus;
+        while (result.m_slots[pos] != PERFECT_HASH_EMPTY_SLOT) {
+            pos = (pos + 1) % modulus;
+        }
+        result.m_slots[pos] = static_cast<uint32_t>(i);
+    }
+    return result;
+}
+
+} // namespace csrl
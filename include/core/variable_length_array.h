@@ -0,0 +1,37 @@
+/**
+ * @file variable_length_array.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 可变长 C 风格数组的包装，供 TLV 与 JSON 写入器共用
+ * @version 0.1
+ * @date 2025-08-30
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace csrl {
+
+// 用于包装可变长C风格数组的结构
+template<typename T>
+struct VariableLengthArray {
+    uint32_t length;      // 实际元素个数
+    const T* data;        // 数组指针
+    size_t maxSize;       // 数组最大容量（可选，用于安全检查）
+    
+    VariableLengthArray(uint32_t len, const T* arr, size_t max = 0) 
+        : length(len), data(arr), maxSize(max) {}
+};
+
+// 辅助函数：创建可变长数组包装
+template<typename T, size_t N>
+VariableLengthArray<T> MakeVariableLengthArray(uint32_t length, const T (&array)[N])
+{
+    return VariableLengthArray<T>(std::min(length, static_cast<uint32_t>(N)), array, N);
+}
+
+} // namespace csrl
@@ -0,0 +1,37 @@
+/**
+ * @file json_common.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief JSON 读写共用的错误码与类型萃取
+ * @version 0.1
+ * @date 2025-08-23
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "define_tuple_interface.h"
+#include "define_type_traits.h"
+
+namespace csrl {
+
+enum JsonErrorCode : int32_t {
+    JSON_OK = 0,
+    JSON_ERR_PARSE = -1,          // JSON 文本不合法
+    JSON_ERR_TYPE_MISMATCH = -2,  // JSON 值的类型与目标字段不匹配
+    JSON_ERR_OUT_OF_RANGE = -3,   // 数值超出目标类型范围，或数组元素个数超过目标数组容量
+    JSON_ERR_INVALID_VALUE = -4,  // 值无法用 JSON 表示（如 NaN、无穷大）
+    JSON_ERR_OVERFLOW = -5,       // 调用方提供的缓冲区空间不足
+};
+
+// 检测类型是否由 DEFINE_STRUCT_WITH_TUPLE_INTERFACE 定义（即生成了 FieldNameGetter）
+template <typename T, typename = void>
+struct HasFieldNameGetter : std::false_type {};
+
+template <typename T>
+struct HasFieldNameGetter<T, void_t<decltype(FieldNameGetter<T, 0>::Get())>> : std::true_type {};
+
+} // namespace csrl
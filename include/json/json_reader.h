@@ -0,0 +1,300 @@
+/**
+ * @file json_reader.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief JSON 读取器，用于将 JSON 文本反序列化为元组接口结构体
+ * @version 0.1
+ * @date 2025-08-16
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "define_tuple_interface.h"
+#include "define_type_traits.h"
+#include "field_names.h"
+#include "json_common.h"
+#include "yyjson.h"
+
+namespace csrl {
+
+// 将 yyjson 不可变值递归写入 C++ 值，支持的类型与 JsonValueConverter 对应
+// VariableLengthArray 只引用外部数组、不持有元素，无法作为反序列化目标，不在此列
+// 结构体中 JSON 不存在的字段保持原值，JSON 中多余的键被忽略
+class JsonValueParser {
+  public:
+    // 处理 std::string 类型
+    template <typename T>
+    static typename std::enable_if<std::is_same<T, std::string>::value, int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (!yyjson_is_str(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst.assign(yyjson_get_str(val), yyjson_get_len(val));
+        return JSON_OK;
+    }
+
+    // 处理 bool 类型
+    template <typename T>
+    static typename std::enable_if<std::is_same<T, bool>::value, int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (!yyjson_is_bool(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst = yyjson_get_bool(val);
+        return JSON_OK;
+    }
+
+    // 处理浮点数类型，整数也可以写入浮点字段
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value, int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (!yyjson_is_num(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst = static_cast<T>(yyjson_get_num(val));
+        return JSON_OK;
+    }
+
+    // 处理无符号整数类型
+    template <typename T>
+    static typename std::enable_if<std::is_unsigned<T>::value && std::is_integral<T>::value &&
+                                       !std::is_same<T, bool>::value,
+                                   int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (yyjson_is_sint(val)) {
+            return JSON_ERR_OUT_OF_RANGE;
+        }
+        if (!yyjson_is_uint(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        uint64_t value = yyjson_get_uint(val);
+        if (value > std::numeric_limits<T>::max()) {
+            return JSON_ERR_OUT_OF_RANGE;
+        }
+        dst = static_cast<T>(value);
+        return JSON_OK;
+    }
+
+    // 处理有符号整数类型
+    template <typename T>
+    static typename std::enable_if<std::is_signed<T>::value && std::is_integral<T>::value, int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (yyjson_is_uint(val)) {
+            uint64_t value = yyjson_get_uint(val);
+            if (value > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+                return JSON_ERR_OUT_OF_RANGE;
+            }
+            dst = static_cast<T>(value);
+            return JSON_OK;
+        }
+        if (!yyjson_is_sint(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        int64_t value = yyjson_get_sint(val);
+        if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+            return JSON_ERR_OUT_OF_RANGE;
+        }
+        dst = static_cast<T>(value);
+        return JSON_OK;
+    }
+
+    // 处理 C 风格字符数组，超出容量的部分被截断，结果始终以 '\0' 结尾
+    template <size_t N>
+    static int32_t Parse(yyjson_val* val, char (&dst)[N])
+    {
+        if (!yyjson_is_str(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        size_t copyLen = std::min(yyjson_get_len(val), N - 1);
+        memcpy(dst, yyjson_get_str(val), copyLen);
+        dst[copyLen] = '\0';
+        return JSON_OK;
+    }
+
+    // 处理 C 风格数组，JSON 数组元素个数不能超过数组容量
+    template <typename T, size_t N>
+    static int32_t Parse(yyjson_val* val, T (&dst)[N])
+    {
+        if (!yyjson_is_arr(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        if (yyjson_arr_size(val) > N) {
+            return JSON_ERR_OUT_OF_RANGE;
+        }
+        return ParseElements(val, dst);
+    }
+
+    // 处理 std::array，JSON 数组元素个数不能超过数组容量
+    template <typename T, size_t N>
+    static int32_t Parse(yyjson_val* val, std::array<T, N>& dst)
+    {
+        if (!yyjson_is_arr(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        if (yyjson_arr_size(val) > N) {
+            return JSON_ERR_OUT_OF_RANGE;
+        }
+        return ParseElements(val, dst.data());
+    }
+
+    // 处理 std::vector
+    template <typename T, typename Alloc>
+    static int32_t Parse(yyjson_val* val, std::vector<T, Alloc>& dst)
+    {
+        if (!yyjson_is_arr(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst.resize(yyjson_arr_size(val));
+        return ParseElements(val, dst.data());
+    }
+
+    // std::vector<bool> 按位存储，没有连续的 bool 数组，只能逐个写入
+    template <typename Alloc>
+    static int32_t Parse(yyjson_val* val, std::vector<bool, Alloc>& dst)
+    {
+        if (!yyjson_is_arr(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst.resize(yyjson_arr_size(val));
+        size_t idx = 0;
+        size_t max = 0;
+        yyjson_val* elem = nullptr;
+        yyjson_arr_foreach(val, idx, max, elem)
+        {
+            bool value = false;
+            int32_t ret = Parse(elem, value);
+            if (ret != JSON_OK) {
+                return ret;
+            }
+            dst[idx] = value;
+        }
+        return JSON_OK;
+    }
+
+    // 处理以 std::string 为键的 std::map，原有内容被 JSON 对象替换
+    template <typename V, typename Compare, typename Alloc>
+    static int32_t Parse(yyjson_val* val, std::map<std::string, V, Compare, Alloc>& dst)
+    {
+        return ParseMap(val, dst);
+    }
+
+    // 处理以 std::string 为键的 std::unordered_map，原有内容被 JSON 对象替换
+    template <typename V, typename Hash, typename KeyEqual, typename Alloc>
+    static int32_t Parse(yyjson_val* val, std::unordered_map<std::string, V, Hash, KeyEqual, Alloc>& dst)
+    {
+        return ParseMap(val, dst);
+    }
+
+    // 处理元组接口结构体：遍历 JSON 对象的键，通过编译期字段名表定位字段
+    template <typename T>
+    static typename std::enable_if<HasFieldNameGetter<T>::value, int32_t>::type
+    Parse(yyjson_val* val, T& dst)
+    {
+        if (!yyjson_is_obj(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        using TableType = FieldNames<T>;
+        yyjson_obj_iter iter = yyjson_obj_iter_with(val);
+        yyjson_val* key = nullptr;
+        while ((key = yyjson_obj_iter_next(&iter)) != nullptr) {
+            size_t fieldIndex = TableType::Find(yyjson_get_str(key), yyjson_get_len(key));
+            if (fieldIndex == TableType::m_count) {
+                continue;
+            }
+            int32_t ret = ParseField(fieldIndex, yyjson_obj_iter_get_val(key), dst,
+                                     std::make_index_sequence<TableType::m_count>{});
+            if (ret != JSON_OK) {
+                return ret;
+            }
+        }
+        return JSON_OK;
+    }
+
+  private:
+    // JSON 中重复的键以最后一个为准
+    template <typename Map>
+    static int32_t ParseMap(yyjson_val* val, Map& dst)
+    {
+        if (!yyjson_is_obj(val)) {
+            return JSON_ERR_TYPE_MISMATCH;
+        }
+        dst.clear();
+        yyjson_obj_iter iter = yyjson_obj_iter_with(val);
+        yyjson_val* key = nullptr;
+        while ((key = yyjson_obj_iter_next(&iter)) != nullptr) {
+            typename Map::mapped_type value{};
+            int32_t ret = Parse(yyjson_obj_iter_get_val(key), value);
+            if (ret != JSON_OK) {
+                return ret;
+            }
+            dst[std::string(yyjson_get_str(key), yyjson_get_len(key))] = std::move(value);
+        }
+        return JSON_OK;
+    }
+
+    template <typename T>
+    static int32_t ParseElements(yyjson_val* arr, T* dst)
+    {
+        size_t idx = 0;
+        size_t max = 0;
+        yyjson_val* elem = nullptr;
+        yyjson_arr_foreach(arr, idx, max, elem)
+        {
+            int32_t ret = Parse(elem, dst[idx]);
+            if (ret != JSON_OK) {
+                return ret;
+            }
+        }
+        return JSON_OK;
+    }
+
+    template <typename T, size_t I>
+    static int32_t ParseFieldAt(yyjson_val* val, T& dst)
+    {
+        return Parse(val, csrl::Get<I>(dst));
+    }
+
+    template <typename T, size_t... I>
+    static int32_t ParseField(size_t fieldIndex, yyjson_val* val, T& dst, std::index_sequence<I...>)
+    {
+        // 跳转表，末尾的空指针仅用于保持数组合法
+        using ParseFunc = int32_t (*)(yyjson_val*, T&);
+        static constexpr ParseFunc funcs[] = {&ParseFieldAt<T, I>..., nullptr};
+        return funcs[fieldIndex](val, dst);
+    }
+};
+
+// 解析 JSON 文本并写入 dst，JSON 文本不会被修改
+template <typename T>
+int32_t FromJson(const char* json, size_t len, T& dst, const yyjson_alc* alc = nullptr)
+{
+    yyjson_doc* doc = yyjson_read_opts(const_cast<char*>(json), len, YYJSON_READ_NOFLAG, alc, nullptr);
+    if (doc == nullptr) {
+        return JSON_ERR_PARSE;
+    }
+    int32_t ret = JsonValueParser::Parse(yyjson_doc_get_root(doc), dst);
+    yyjson_doc_free(doc);
+    return ret;
+}
+
+} // namespace csrl
@@ -0,0 +1,336 @@
+/**
+ * @file json_text_writer.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 流式 JSON 文本写入器，不构建 DOM，直接将结构体序列化为 JSON 文本
+ * @version 0.1
+ * @date 2025-08-23
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "define_tuple_interface.h"
+#include "define_type_traits.h"
+#include "json_common.h"
+#include "number_format.h"
+#include "variable_length_array.h"
+#include "yyjson.h"
+
+namespace csrl {
+
+template <size_t N>
+struct JsonFragmentChars {
+    char m_chars[N];
+};
+
+// 编译期拼接字段前缀：首个字段为 {"name":，其余字段为 ,"name":
+template <size_t N>
+constexpr JsonFragmentChars<N> BuildJsonFieldFragment(char lead, const char* name)
+{
+    JsonFragmentChars<N> result{};
+    result.m_chars[0] = lead;
+    result.m_chars[1] = '"';
+    for (size_t i = 0; i + 4 < N; ++i) {
+        result.m_chars[i + 2] = name[i];
+    }
+    result.m_chars[N - 2] = '"';
+    result.m_chars[N - 1] = ':';
+    return result;
+}
+
+// 结构体第 I 个字段的常量前缀，字段名是合法的标识符，无需转义
+template <typename T, size_t I>
+struct JsonFieldFragment {
+    static constexpr size_t m_size = FieldNameGetter<T, I>::Length() + 4;
+    static constexpr JsonFragmentChars<m_size> m_text =
+        BuildJsonFieldFragment<m_size>(I == 0 ? '{' : ',', FieldNameGetter<T, I>::Get());
+};
+
+template <typename T, size_t I>
+constexpr JsonFragmentChars<JsonFieldFragment<T, I>::m_size> JsonFieldFragment<T, I>::m_text;
+
+// 流式 JSON 文本写入器，支持的类型与 JsonValueConverter 一致
+// 默认写入自有的可增长缓冲区，也可以写入调用方提供的定长缓冲区（空间不足时返回 JSON_ERR_OVERFLOW）
+// 写入失败时撤销本次 Write 输出的内容，并将错误码保存在 status() 中，此后不再写入，直到 clear()
+class JsonTextWriter {
+  public:
+    explicit JsonTextWriter(size_t initialCapacity = 1024)
+        : m_buffer(std::max<size_t>(initialCapacity, 1)), m_data(m_buffer.data()), m_capacity(m_buffer.size())
+    {
+    }
+
+    JsonTextWriter(char* buffer, size_t capacity)
+        : m_data(buffer), m_capacity(buffer == nullptr ? 0 : capacity), m_fixed(true)
+    {
+    }
+
+    JsonTextWriter(const JsonTextWriter&) = delete;
+    JsonTextWriter& operator=(const JsonTextWriter&) = delete;
+
+    // 追加一个值的 JSON 文本
+    template <typename T>
+    int32_t Write(const T& value)
+    {
+        if (m_status != JSON_OK) {
+            return m_status;
+        }
+        size_t start = m_size;
+        int32_t ret = WriteValue(value);
+        if (ret != JSON_OK) {
+            m_size = start;
+            m_status = ret;
+        }
+        return m_status;
+    }
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    std::string str() const { return std::string(m_data, m_size); }
+    int32_t status() const { return m_status; }
+
+    void clear()
+    {
+        m_size = 0;
+        m_status = JSON_OK;
+    }
+
+  private:
+    // 确保剩余空间至少为 len 字节
+    bool Reserve(size_t len)
+    {
+        if (len <= m_capacity - m_size) {
+            return true;
+        }
+        if (m_fixed) {
+            return false;
+        }
+        m_buffer.resize(std::max(m_capacity * 2, m_size + len));
+        m_data = m_buffer.data();
+        m_capacity = m_buffer.size();
+        return true;
+    }
+
+    int32_t Append(const char* text, size_t len)
+    {
+        if (!Reserve(len)) {
+            return JSON_ERR_OVERFLOW;
+        }
+        memcpy(m_data + m_size, text, len);
+        m_size += len;
+        return JSON_OK;
+    }
+
+    int32_t Append(char ch) { return Append(&ch, 1); }
+
+    // 处理 std::string 类型
+    template <typename T>
+    typename std::enable_if<std::is_same<remove_cvref_t<T>, std::string>::value, int32_t>::type
+    WriteValue(const T& str)
+    {
+        return WriteString(str.data(), str.size());
+    }
+
+    // 处理 bool 类型
+    template <typename T>
+    typename std::enable_if<std::is_same<remove_cvref_t<T>, bool>::value, int32_t>::type
+    WriteValue(const T& value)
+    {
+        return value ? Append("true", 4) : Append("false", 5);
+    }
+
+    // 处理浮点数类型，使用 yyjson 的最短往返格式，NaN 与无穷大无法用 JSON 表示
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<remove_cvref_t<T>>::value, int32_t>::type
+    WriteValue(const T& value)
+    {
+        char buf[NUMBER_BUFFER_SIZE];
+        size_t len = FormatShortest(value, buf, YYJSON_WRITE_NOFLAG);
+        if (len == 0) {
+            return JSON_ERR_INVALID_VALUE;
+        }
+        return Append(buf, len);
+    }
+
+    // 处理整数类型（bool 除外）
+    template <typename T>
+    typename std::enable_if<std::is_integral<remove_cvref_t<T>>::value && !std::is_same<remove_cvref_t<T>, bool>::value,
+                            int32_t>::type
+    WriteValue(const T& value)
+    {
+        char buf[NUMBER_BUFFER_SIZE];
+        char* begin = FormatDecimal(value, buf + NUMBER_BUFFER_SIZE);
+        return Append(begin, static_cast<size_t>(buf + NUMBER_BUFFER_SIZE - begin));
+    }
+
+    // 处理 C 风格字符数组，按以 '\0' 结尾的字符串处理
+    template <size_t N>
+    int32_t WriteValue(const char (&str)[N])
+    {
+        return WriteString(str, strnlen(str, N));
+    }
+
+    // 处理 C 风格数组
+    template <typename T, size_t N>
+    int32_t WriteValue(const T (&array)[N])
+    {
+        return WriteRange(array, array + N);
+    }
+
+    // 处理 std::array
+    template <typename T, size_t N>
+    int32_t WriteValue(const std::array<T, N>& array)
+    {
+        return WriteRange(array.begin(), array.end());
+    }
+
+    // 处理 std::vector
+    template <typename T, typename Alloc>
+    int32_t WriteValue(const std::vector<T, Alloc>& vec)
+    {
+        return WriteRange(vec.begin(), vec.end());
+    }
+
+    // 处理可变长数组，只输出有效的 length 个元素
+    template <typename T>
+    int32_t WriteValue(const VariableLengthArray<T>& array)
+    {
+        return WriteRange(array.data, array.data + array.length);
+    }
+
+    // 处理以 std::string 为键的 std::map
+    template <typename V, typename Compare, typename Alloc>
+    int32_t WriteValue(const std::map<std::string, V, Compare, Alloc>& map)
+    {
+        return WriteMap(map.begin(), map.end());
+    }
+
+    // 处理以 std::string 为键的 std::unordered_map
+    template <typename V, typename Hash, typename KeyEqual, typename Alloc>
+    int32_t WriteValue(const std::unordered_map<std::string, V, Hash, KeyEqual, Alloc>& map)
+    {
+        return WriteMap(map.begin(), map.end());
+    }
+
+    // 处理元组接口结构体，字段前缀为编译期常量
+    template <typename T>
+    typename std::enable_if<HasFieldNameGetter<T>::value, int32_t>::type WriteValue(const T& value)
+    {
+        int32_t ret = WriteAllFields(value, std::make_index_sequence<FieldCount<T>::value>{});
+        return ret == JSON_OK ? Append('}') : ret;
+    }
+
+    template <typename Iterator>
+    int32_t WriteRange(Iterator first, Iterator last)
+    {
+        int32_t ret = Append('[');
+        for (Iterator it = first; it != last && ret == JSON_OK; ++it) {
+            if (it != first) {
+                ret = Append(',');
+            }
+            if (ret == JSON_OK) {
+                ret = WriteValue(static_cast<const typename std::iterator_traits<Iterator>::value_type&>(*it));
+            }
+        }
+        return ret == JSON_OK ? Append(']') : ret;
+    }
+
+    // 键需要转义，不能像结构体字段那样使用编译期前缀
+    template <typename Iterator>
+    int32_t WriteMap(Iterator first, Iterator last)
+    {
+        int32_t ret = Append('{');
+        for (Iterator it = first; it != last && ret == JSON_OK; ++it) {
+            if (it != first) {
+                ret = Append(',');
+            }
+            if (ret == JSON_OK) {
+                ret = WriteString(it->first.data(), it->first.size());
+            }
+            if (ret == JSON_OK) {
+                ret = Append(':');
+            }
+            if (ret == JSON_OK) {
+                ret = WriteValue(it->second);
+            }
+        }
+        return ret == JSON_OK ? Append('}') : ret;
+    }
+
+    template <typename T, size_t I>
+    int32_t WriteField(const T& value)
+    {
+        using Fragment = JsonFieldFragment<T, I>;
+        int32_t ret = Append(Fragment::m_text.m_chars, Fragment::m_size);
+        return ret == JSON_OK ? WriteValue(csrl::Get<I>(value)) : ret;
+    }
+
+    template <typename T, size_t... I>
+    int32_t WriteAllFields(const T& value, std::index_sequence<I...>)
+    {
+        int32_t ret = JSON_OK;
+        // 展开所有字段依次写入 (C++17中可以用fold expression简化)
+        int dummy[] = {0, (ret = (ret == JSON_OK ? WriteField<T, I>(value) : ret), 0)...};
+        (void)dummy; // 避免未使用变量警告
+        return ret;
+    }
+
+    // 写入带引号的字符串，转义 '"'、'\\' 与控制字符，其余字节（包括 UTF-8）原样拷贝
+    int32_t WriteString(const char* str, size_t len)
+    {
+        static const char hexDigits[] = "0123456789abcdef";
+        int32_t ret = Append('"');
+        size_t runStart = 0;
+        for (size_t i = 0; i < len && ret == JSON_OK; ++i) {
+            unsigned char ch = static_cast<unsigned char>(str[i]);
+            if (ch >= 0x20 && ch != '"' && ch != '\\') {
+                continue;
+            }
+            ret = Append(str + runStart, i - runStart);
+            runStart = i + 1;
+            if (ret != JSON_OK) {
+                break;
+            }
+            switch (ch) {
+                case '"': ret = Append("\\\"", 2); break;
+                case '\\': ret = Append("\\\\", 2); break;
+                case '\b': ret = Append("\\b", 2); break;
+                case '\f': ret = Append("\\f", 2); break;
+                case '\n': ret = Append("\\n", 2); break;
+                case '\r': ret = Append("\\r", 2); break;
+                case '\t': ret = Append("\\t", 2); break;
+                default: {
+                    char escaped[6] = {'\\', 'u', '0', '0', hexDigits[ch >> 4], hexDigits[ch & 0xF]};
+                    ret = Append(escaped, sizeof(escaped));
+                    break;
+                }
+            }
+        }
+        if (ret == JSON_OK) {
+            ret = Append(str + runStart, len - runStart);
+        }
+        return ret == JSON_OK ? Append('"') : ret;
+    }
+
+    std::vector<char> m_buffer;
+    char* m_data;
+    size_t m_capacity;
+    size_t m_size = 0;
+    bool m_fixed = false;
+    int32_t m_status = JSON_OK;
+};
+
+} // namespace csrl
@@ -10,21 +10,361 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "define_tuple_interface.h"
 #include "define_type_traits.h"
+#include "json_common.h"
+#include "string_literal.h"
+#include "variable_length_array.h"
 #include "yyjson.h"
 
 namespace csrl {
 
+// 数值数组通过 yyjson 的批量接口一次性申请全部元素，而不是逐个追加
+#define DEFINE_JSON_BULK_ARRAY(Type, Func)                                                          \
+    inline yyjson_mut_val* JsonBulkArray(yyjson_mut_doc* doc, const Type* vals, size_t count)    \
+    {                                                                                             \
+        return Func(doc, vals, count);                                                            \
+    }
+
+DEFINE_JSON_BULK_ARRAY(bool, yyjson_mut_arr_with_bool)
+DEFINE_JSON_BULK_ARRAY(int8_t, yyjson_mut_arr_with_sint8)
+DEFINE_JSON_BULK_ARRAY(int16_t, yyjson_mut_arr_with_sint16)
+DEFINE_JSON_BULK_ARRAY(int32_t, yyjson_mut_arr_with_sint32)
+DEFINE_JSON_BULK_ARRAY(int64_t, yyjson_mut_arr_with_sint64)
+DEFINE_JSON_BULK_ARRAY(uint8_t, yyjson_mut_arr_with_uint8)
+DEFINE_JSON_BULK_ARRAY(uint16_t, yyjson_mut_arr_with_uint16)
+DEFINE_JSON_BULK_ARRAY(uint32_t, yyjson_mut_arr_with_uint32)
+DEFINE_JSON_BULK_ARRAY(uint64_t, yyjson_mut_arr_with_uint64)
+DEFINE_JSON_BULK_ARRAY(float, yyjson_mut_arr_with_float)
+DEFINE_JSON_BULK_ARRAY(double, yyjson_mut_arr_with_double)
+
+#undef DEFINE_JSON_BULK_ARRAY
+
+// 元素类型是否有对应的批量接口，其余类型（如 long long、结构体）逐个转换
+template <typename T, typename = void>
+struct HasJsonBulkArray : std::false_type {};
+
+template <typename T>
+struct HasJsonBulkArray<T, void_t<decltype(JsonBulkArray(std::declval<yyjson_mut_doc*>(), std::declval<const T*>(),
+                                                         std::declval<size_t>()))>> : std::true_type {};
+
+// JSON 对象的键：只记录指针与长度，避免构造 std::string 临时对象以及 yyjson_mut_strcpy 中的 strlen
+// 只有 FieldName<T, I>() 得到的字段名键直接引用静态存储期的字符数据（yyjson_mut_strn），其余来源的键都会拷贝到文档中
+// StringLiteral 可能是局部变量或临时对象，同样按拷贝处理
+class JsonKey {
+  public:
+    JsonKey(const std::string& key) noexcept : m_data(key.data()), m_size(key.size()) {}
+
+    JsonKey(const char* key, size_t len) noexcept : m_data(key), m_size(len) {}
+
+    // 字符数组可能是局部缓冲区，按 '\0' 截断并拷贝
+    template <size_t N>
+    JsonKey(const char (&key)[N]) noexcept : m_data(key), m_size(strnlen(key, N))
+    {
+    }
+
+    // 字符指针，数组由上面的重载处理
+    template <typename S, typename std::enable_if<std::is_convertible<S, const char*>::value && !std::is_array<S>::value,
+                                                  int>::type = 0>
+    JsonKey(const S& key) noexcept : m_data(key), m_size(m_data == nullptr ? 0 : strlen(m_data))
+    {
+    }
+
+    template <size_t N>
+    JsonKey(const StringLiteral<N>& key) noexcept : m_data(key.data()), m_size(key.size())
+    {
+    }
+
+    // 结构体 T 第 I 个字段的字段名，字符数据位于静态存储期，生命周期覆盖任何文档，不需要拷贝
+    template <typename T, size_t I>
+    static JsonKey FieldName() noexcept
+    {
+        JsonKey key(FieldNameGetter<T, I>::Get(), FieldNameGetter<T, I>::Length());
+        key.m_static = true;
+        return key;
+    }
+
+    yyjson_mut_val* ToValue(yyjson_mut_doc* doc) const noexcept
+    {
+        return m_static ? yyjson_mut_strn(doc, m_data, m_size) : yyjson_mut_strncpy(doc, m_data, m_size);
+    }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+    bool m_static = false;
+};
+
+// 将 C++ 值递归转换为 yyjson 可变值：
+// 基础类型、std::string、C 风格数组（char 数组视为字符串）、std::vector、std::array、VariableLengthArray、
+// 以 std::string 为键的 std::map/std::unordered_map 以及元组接口结构体
+class JsonValueConverter {
+  public:
+    // 处理 std::string 类型
+    template <typename T>
+    static typename std::enable_if<std::is_same<remove_cvref_t<T>, std::string>::value, yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& str) noexcept
+    {
+        return yyjson_mut_strncpy(doc, str.data(), str.size());
+    }
+
+    // 处理 bool 类型
+    template <typename T>
+    static typename std::enable_if<std::is_same<remove_cvref_t<T>, bool>::value, yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& value) noexcept
+    {
+        return yyjson_mut_bool(doc, value);
+    }
+
+    // 处理浮点数类型
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<remove_cvref_t<T>>::value, yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& value) noexcept
+    {
+        return yyjson_mut_real(doc, static_cast<double>(value));
+    }
+
+    // 处理无符号整数类型
+    template <typename T>
+    static typename std::enable_if<std::is_unsigned<remove_cvref_t<T>>::value &&
+                                       std::is_integral<remove_cvref_t<T>>::value &&
+                                       !std::is_same<remove_cvref_t<T>, bool>::value,
+                                   yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& value) noexcept
+    {
+        return yyjson_mut_uint(doc, static_cast<uint64_t>(value));
+    }
+
+    // 处理有符号整数类型
+    template <typename T>
+    static typename std::enable_if<std::is_signed<remove_cvref_t<T>>::value &&
+                                       std::is_integral<remove_cvref_t<T>>::value,
+                                   yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& value) noexcept
+    {
+        return yyjson_mut_int(doc, static_cast<int64_t>(value));
+    }
+
+    // 处理 C 风格字符数组，按以 '\0' 结尾的字符串处理
+    template <size_t N>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const char (&str)[N]) noexcept
+    {
+        return yyjson_mut_strncpy(doc, str, strnlen(str, N));
+    }
+
+    // 处理 C 风格数组
+    template <typename T, size_t N>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const T (&array)[N]) noexcept
+    {
+        return ConvertArray(doc, array, N);
+    }
+
+    // 处理 std::array
+    template <typename T, size_t N>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const std::array<T, N>& array) noexcept
+    {
+        return ConvertArray(doc, array.data(), N);
+    }
+
+    // 处理 std::vector
+    template <typename T, typename Alloc>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const std::vector<T, Alloc>& vec) noexcept
+    {
+        return ConvertArray(doc, vec.data(), vec.size());
+    }
+
+    // std::vector<bool> 按位存储，没有连续的 bool 数组，只能逐个转换
+    template <typename Alloc>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const std::vector<bool, Alloc>& vec) noexcept
+    {
+        return ConvertRange(doc, vec.begin(), vec.end());
+    }
+
+    // 处理可变长数组，只输出有效的 length 个元素
+    template <typename T>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const VariableLengthArray<T>& array) noexcept
+    {
+        return ConvertArray(doc, array.data, array.length);
+    }
+
+    // 处理以 std::string 为键的 std::map
+    template <typename V, typename Compare, typename Alloc>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc, const std::map<std::string, V, Compare, Alloc>& map) noexcept
+    {
+        return ConvertMap(doc, map.begin(), map.end());
+    }
+
+    // 处理以 std::string 为键的 std::unordered_map，键的输出顺序与遍历顺序一致
+    template <typename V, typename Hash, typename KeyEqual, typename Alloc>
+    static yyjson_mut_val* Convert(yyjson_mut_doc* doc,
+                                   const std::unordered_map<std::string, V, Hash, KeyEqual, Alloc>& map) noexcept
+    {
+        return ConvertMap(doc, map.begin(), map.end());
+    }
+
+    // 处理元组接口结构体，字段名为字符串字面量，直接引用而不拷贝
+    template <typename T>
+    static typename std::enable_if<HasFieldNameGetter<T>::value, yyjson_mut_val*>::type
+    Convert(yyjson_mut_doc* doc, const T& value) noexcept
+    {
+        yyjson_mut_val* obj = yyjson_mut_obj(doc);
+        if (obj == nullptr) {
+            return nullptr;
+        }
+        return AddAllFields(doc, value, obj, std::make_index_sequence<FieldCount<T>::value>{}) ? obj : nullptr;
+    }
+
+  private:
+    // 连续存储的数组：数值与 bool 元素走批量接口，其余元素逐个转换
+    template <typename T>
+    static yyjson_mut_val* ConvertArray(yyjson_mut_doc* doc, const T* data, size_t count) noexcept
+    {
+        return ConvertArray(doc, data, count, HasJsonBulkArray<T>{});
+    }
+
+    template <typename T>
+    static yyjson_mut_val* ConvertArray(yyjson_mut_doc* doc, const T* data, size_t count, std::true_type) noexcept
+    {
+        return JsonBulkArray(doc, data, count);
+    }
+
+    template <typename T>
+    static yyjson_mut_val* ConvertArray(yyjson_mut_doc* doc, const T* data, size_t count, std::false_type) noexcept
+    {
+        return ConvertRange(doc, data, data + count);
+    }
+
+    template <typename Iterator>
+    static yyjson_mut_val* ConvertMap(yyjson_mut_doc* doc, Iterator first, Iterator last) noexcept
+    {
+        yyjson_mut_val* obj = yyjson_mut_obj(doc);
+        if (obj == nullptr) {
+            return nullptr;
+        }
+        for (; first != last; ++first) {
+            yyjson_mut_val* key = yyjson_mut_strncpy(doc, first->first.data(), first->first.size());
+            yyjson_mut_val* val = Convert(doc, first->second);
+            if (key == nullptr || val == nullptr || !yyjson_mut_obj_add(obj, key, val)) {
+                return nullptr;
+            }
+        }
+        return obj;
+    }
+
+    template <typename Iterator>
+    static yyjson_mut_val* ConvertRange(yyjson_mut_doc* doc, Iterator first, Iterator last) noexcept
+    {
+        yyjson_mut_val* arr = yyjson_mut_arr(doc);
+        if (arr == nullptr) {
+            return nullptr;
+        }
+        for (; first != last; ++first) {
+            yyjson_mut_val* val = Convert(doc, static_cast<const typename std::iterator_traits<Iterator>::value_type&>(*first));
+            if (val == nullptr || !yyjson_mut_arr_add_val(arr, val)) {
+                return nullptr;
+            }
+        }
+        return arr;
+    }
+
+    template <typename T, size_t I>
+    static bool AddField(yyjson_mut_doc* doc, const T& value, yyjson_mut_val* obj) noexcept
+    {
+        yyjson_mut_val* val = Convert(doc, csrl::Get<I>(value));
+        return val != nullptr && yyjson_mut_obj_add(obj, JsonKey::FieldName<T, I>().ToValue(doc), val);
+    }
+
+    template <typename T, size_t... I>
+    static bool AddAllFields(yyjson_mut_doc* doc, const T& value, yyjson_mut_val* obj, std::index_sequence<I...>) noexcept
+    {
+        bool ok = true;
+        // 展开所有字段依次添加 (C++17中可以用fold expression简化)
+        int dummy[] = {0, (ok = ok && AddField<T, I>(doc, value, obj), 0)...};
+        (void)dummy; // 避免未使用变量警告
+        return ok;
+    }
+};
+
+// 将值序列化为新的 yyjson 可变文档，结构体按字段名生成 JSON 对象
+// 返回的文档由调用方通过 yyjson_mut_doc_free 释放，失败时返回 nullptr
+template <typename T>
+yyjson_mut_doc* ToJson(const T& value, const yyjson_alc* alc = nullptr)
+{
+    yyjson_mut_doc* doc = yyjson_mut_doc_new(alc);
+    if (doc == nullptr) {
+        return nullptr;
+    }
+    yyjson_mut_val* root = JsonValueConverter::Convert(doc, value);
+    if (root == nullptr) {
+        yyjson_mut_doc_free(doc);
+        return nullptr;
+    }
+    yyjson_mut_doc_set_root(doc, root);
+    return doc;
+}
+
+// 文档内存可以来自三种来源：
+// 1. 外部传入的文档，由 JsonWriter 负责释放
+// 2. 默认构造时自带的动态内存池（yyjson_alc_dyn_new），Reset() 后内存留在池中复用，稳态下不再调用 malloc
+// 3. 调用方提供的定长缓冲区（yyjson_alc_pool_init），内存不足时各接口返回 nullptr
 class JsonWriter {
   public:
-    JsonWriter(yyjson_mut_doc* doc) { m_doc = doc; }
+    JsonWriter() noexcept;
 
-    // yyjson_mut_doc_free 内部会判断指针是否为空，所以这里不需要判断
-    ~JsonWriter() { yyjson_mut_doc_free(m_doc); }
+    JsonWriter(void* buffer, size_t size) noexcept;
+
+    // 接管 doc 的所有权，调用方不能再释放 doc
+    explicit JsonWriter(yyjson_mut_doc* doc) noexcept : m_doc(doc) {}
+
+    ~JsonWriter() { Release(); }
+
+    // 文档与内存池的生命周期绑定在对象上，只能移动不能拷贝
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    JsonWriter(JsonWriter&& other) noexcept
+        : m_doc(other.m_doc), m_currentObject(other.m_currentObject), m_poolAlc(other.m_poolAlc),
+          m_dynAlc(other.m_dynAlc)
+    {
+        other.m_doc = nullptr;
+        other.m_currentObject = nullptr;
+        other.m_dynAlc = nullptr;
+    }
+
+    JsonWriter& operator=(JsonWriter&& other) noexcept
+    {
+        if (this != &other) {
+            Release();
+            m_doc = other.m_doc;
+            m_currentObject = other.m_currentObject;
+            m_poolAlc = other.m_poolAlc;
+            m_dynAlc = other.m_dynAlc;
+            other.m_doc = nullptr;
+            other.m_currentObject = nullptr;
+            other.m_dynAlc = nullptr;
+        }
+        return *this;
+    }
+
+    // 丢弃当前文档并以相同的分配器创建新文档，已申请的内存归还给内存池以便复用
+    bool Reset() noexcept;
+
+    // 将当前文档序列化到 out，复用 out 已有的容量；输出缓冲区从文档的分配器申请，写完即释放
+    int32_t Serialize(std::string& out, yyjson_write_flag flag = YYJSON_WRITE_NOFLAG) const noexcept;
+
+    yyjson_mut_doc* GetDoc() const noexcept { return m_doc; }
 
     yyjson_mut_val* SetArrayAsRoot(const size_t) noexcept;
 
@@ -51,11 +391,11 @@ class JsonWriter {
         return val;
     }
 
-    yyjson_mut_val* AddArrayToObject(const std::string& key, yyjson_mut_val* object) noexcept
+    yyjson_mut_val* AddArrayToObject(JsonKey key, yyjson_mut_val* object) noexcept
     {
         const auto val = yyjson_mut_arr(m_doc);
         if (val) {
-            yyjson_mut_obj_add(object, yyjson_mut_strcpy(m_doc, key.c_str()), val);
+            yyjson_mut_obj_add(object, key.ToValue(m_doc), val);
         }
         return val;
     }
@@ -69,11 +409,11 @@ class JsonWriter {
         return val;
     }
 
-    yyjson_mut_val *AddObjectToObject(const std::string &key, yyjson_mut_val *object) noexcept
+    yyjson_mut_val *AddObjectToObject(JsonKey key, yyjson_mut_val *object) noexcept
     {
         const auto val = yyjson_mut_obj(m_doc);
         if (val) {
-            yyjson_mut_obj_add(object, yyjson_mut_strcpy(m_doc, key.c_str()), val);
+            yyjson_mut_obj_add(object, key.ToValue(m_doc), val);
         }
         return val;
     }
@@ -89,11 +429,11 @@ class JsonWriter {
     }
 
     template <typename T>
-    yyjson_mut_val* AddValueToObject(const std::string& key, const T& value, yyjson_mut_val* object) noexcept 
+    yyjson_mut_val* AddValueToObject(JsonKey key, const T& value, yyjson_mut_val* object) noexcept 
     {
         const auto val = FromBasicValue(value);
         if (val) {
-            yyjson_mut_obj_add(object, yyjson_mut_strcpy(m_doc, key.c_str()), val);
+            yyjson_mut_obj_add(object, key.ToValue(m_doc), val);
         }
         return val;
     }
@@ -103,7 +443,7 @@ class JsonWriter {
     yyjson_mut_val* GetCurrentObject() const noexcept { return m_currentObject; }
 
     template <typename T>
-    yyjson_mut_val* AddValueToCurrentObject(const std::string& key, const T& value) noexcept 
+    yyjson_mut_val* AddValueToCurrentObject(JsonKey key, const T& value) noexcept 
     {
         if (m_currentObject) {
             return AddValueToObject(key, value, m_currentObject);
@@ -111,7 +451,7 @@ class JsonWriter {
         return nullptr;
     }
 
-    yyjson_mut_val* AddArrayToCurrentObject(const std::string& key) noexcept
+    yyjson_mut_val* AddArrayToCurrentObject(JsonKey key) noexcept
     {
         if (m_currentObject) {
             return AddArrayToObject(key, m_currentObject);
@@ -119,7 +459,7 @@ class JsonWriter {
         return nullptr;
     }
 
-    yyjson_mut_val* AddObjectToCurrentObject(const std::string& key) noexcept
+    yyjson_mut_val* AddObjectToCurrentObject(JsonKey key) noexcept
     {
         if (m_currentObject) {
             return AddObjectToObject(key, m_currentObject);
@@ -128,52 +468,28 @@ class JsonWriter {
     }
 
   private:
-    // 处理 std::string 类型
-    template <typename T>
-    typename std::enable_if<std::is_same<csrl::remove_cvref_t<T>, std::string>::value, yyjson_mut_val*>::type
-    FromBasicValue(const T& str) noexcept 
-    {
-        return yyjson_mut_strcpy(m_doc, str.c_str());
-    }
-
-    // 处理 bool 类型
-    template <typename T>
-    typename std::enable_if<std::is_same<csrl::remove_cvref_t<T>, bool>::value, yyjson_mut_val*>::type
-    FromBasicValue(const T& value) noexcept 
-    {
-        return yyjson_mut_bool(m_doc, value);
-    }
-
-    // 处理浮点数类型
-    template <typename T>
-    typename std::enable_if<std::is_floating_point<csrl::remove_cvref_t<T>>::value, yyjson_mut_val*>::type
-    FromBasicValue(const T& value) noexcept 
-    {
-        return yyjson_mut_real(m_doc, static_cast<double>(value));
-    }
-
-    // 处理无符号整数类型
-    template <typename T>
-    typename std::enable_if<std::is_unsigned<csrl::remove_cvref_t<T>>::value &&
-                                std::is_integral<csrl::remove_cvref_t<T>>::value &&
-                                !std::is_same<csrl::remove_cvref_t<T>, bool>::value,
-                            yyjson_mut_val*>::type
-    FromBasicValue(const T& value) noexcept 
+    // yyjson_mut_doc_free 内部会判断指针是否为空，所以这里不需要判断
+    void Release() noexcept
     {
-        return yyjson_mut_uint(m_doc, static_cast<uint64_t>(value));
+        yyjson_mut_doc_free(m_doc);
+        m_doc = nullptr;
+        m_currentObject = nullptr;
+        if (m_dynAlc != nullptr) {
+            yyjson_alc_dyn_free(m_dynAlc);
+            m_dynAlc = nullptr;
+        }
     }
 
-    // 处理有符号整数类型
+    // 基础类型、容器与元组接口结构体统一由 JsonValueConverter 转换
     template <typename T>
-    typename std::enable_if<std::is_signed<csrl::remove_cvref_t<T>>::value &&
-                                std::is_integral<csrl::remove_cvref_t<T>>::value,
-                            yyjson_mut_val*>::type
-    FromBasicValue(const T& value) noexcept
+    yyjson_mut_val* FromBasicValue(const T& value) noexcept
     {
-        return yyjson_mut_int(m_doc, static_cast<int64_t>(value));
+        return JsonValueConverter::Convert(m_doc, value);
     }
 
-    yyjson_mut_doc* m_doc;
-    yyjson_mut_val* m_currentObject;  // 当前正在操作的JSON对象
+    yyjson_mut_doc* m_doc = nullptr;
+    yyjson_mut_val* m_currentObject = nullptr;  // 当前正在操作的JSON对象
+    yyjson_alc m_poolAlc{};                     // 定长缓冲区分配器
+    yyjson_alc* m_dynAlc = nullptr;             // 自有的动态内存池
 };
 } // namespace csrl
@@ -0,0 +1,34 @@
+/**
+ * @file tlv_common.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLV 读写共用的常量与错误码
+ * @version 0.1
+ * @date 2025-07-19
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace csrl {
+
+// TLV 读写错误码
+enum TLVErrorCode : int32_t {
+    TLV_OK = 0,
+    TLV_ERR_TRUNCATED_HEADER = -1,    // 剩余数据不足一个 type + length 头部
+    TLV_ERR_TRUNCATED_VALUE = -2,     // length 声明的长度超出剩余数据
+    TLV_ERR_LENGTH_MISMATCH = -3,     // value 长度与目标字段不匹配
+    TLV_ERR_KEY_MISMATCH = -4,        // value 中的键名与映射规则不一致
+    TLV_ERR_INDEX_OUT_OF_RANGE = -5,  // 数组类字段的记录数超过数组容量
+    TLV_ERR_INVALID_VALUE = -6,       // value 内容无法转换为目标类型
+    TLV_ERR_OVERFLOW = -7,            // 输出目标的剩余空间不足
+    TLV_ERR_IO = -8,                  // 向文件描述符写入数据失败
+};
+
+// TLV 头部大小：type(uint32_t) + length(uint32_t)
+constexpr size_t TLV_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+} // namespace csrl
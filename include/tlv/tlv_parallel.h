@@ -0,0 +1,249 @@
+/**
+ * @file tlv_parallel.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 多线程批量 TLV 编码：将结构体数组切分为连续分块，在多个线程中分别编码后按顺序拼接
+ * @version 0.1
+ * @date 2025-09-06
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "parallel_chunks.h"
+#include "tlv_sink.h"
+#include "tlv_writer.h"
+#include "tlv_writer_pool.h"
+
+namespace csrl {
+
+// 每个线程至少编码的结构体个数，结构体过少时创建线程的开销超过编码本身
+constexpr size_t TLV_PARALLEL_MIN_RECORDS = 1024;
+
+// 分块编码的结果：每个分块一个 TLVWriter，按顺序拼接即为完整的 TLV 流
+// 可以通过 GetIovecs 直接交给 writev/sendmsg，无需拼接；重复使用同一对象时保留各分块的缓冲区
+class TLVChunkedOutput {
+public:
+    // 调整为 chunkCount 个空分块，已有分块的缓冲区被保留
+    void Reset(size_t chunkCount)
+    {
+        for (auto& writer : m_writers) {
+            writer->clear();
+        }
+        while (m_writers.size() < chunkCount) {
+            m_writers.emplace_back(new TLVWriter());
+        }
+        m_chunkCount = chunkCount;
+    }
+
+    size_t ChunkCount() const { return m_chunkCount; }
+    TLVWriter& Writer(size_t index) { return *m_writers[index]; }
+    const TLVWriter& Chunk(size_t index) const { return *m_writers[index]; }
+
+    size_t size() const
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < m_chunkCount; ++i) {
+            total += m_writers[i]->size();
+        }
+        return total;
+    }
+
+    // 第一个出错分块的错误码，全部成功时为 TLV_OK
+    int32_t status() const
+    {
+        for (size_t i = 0; i < m_chunkCount; ++i) {
+            if (m_writers[i]->status() != TLV_OK) {
+                return m_writers[i]->status();
+            }
+        }
+        return TLV_OK;
+    }
+
+    void clear() { Reset(0); }
+
+    // 非空分块的个数
+    size_t IovecCount() const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < m_chunkCount; ++i) {
+            count += m_writers[i]->size() > 0 ? 1 : 0;
+        }
+        return count;
+    }
+
+    // 输出按顺序覆盖全部分块的 iovec 列表，返回使用的 iovec 个数（不超过 maxCount）
+    size_t GetIovecs(struct iovec* out, size_t maxCount) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < m_chunkCount && count < maxCount; ++i) {
+            if (m_writers[i]->size() == 0) {
+                continue;
+            }
+            out[count].iov_base = const_cast<uint8_t*>(m_writers[i]->data());
+            out[count].iov_len = m_writers[i]->size();
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    std::vector<std::unique_ptr<TLVWriter>> m_writers;
+    size_t m_chunkCount = 0;
+};
+
+// 按顺序将 src[0..count) 编码到同一个写入器，结果与逐个调用 StructFieldsConvert 相同
+template <typename SrcStruct, typename Sink, typename RuleTuple>
+void EncodeTLVRecords(const SrcStruct* src, size_t count, BasicTLVWriter<Sink>& dst,
+                      const RuleTuple& mappingRuleTuple)
+{
+    for (size_t i = 0; i < count; ++i) {
+        ConvertAllFields(src[i], dst, mappingRuleTuple, std::make_index_sequence<RuleTuple::size>{});
+    }
+}
+
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSize(const SrcStruct* src, size_t count, const RuleTuple& mappingRuleTuple)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += SerializedSize(src[i], mappingRuleTuple);
+    }
+    return total;
+}
+
+// 预留容量使用的长度上限，数字转字符串等规则按最大长度计入，不需要格式化
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSizeHint(const SrcStruct* src, size_t count, const RuleTuple& mappingRuleTuple)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += SerializedSizeHint(src[i], mappingRuleTuple);
+    }
+    return total;
+}
+
+// 按 plan 多线程编码，每个分块写入 out 中独立的 TLVWriter
+template <typename SrcStruct, typename RuleTuple>
+int32_t EncodeTLVChunks(const SrcStruct* src, const RuleTuple& mappingRuleTuple, const ChunkPlan& plan,
+                        TLVChunkedOutput& out)
+{
+    out.Reset(plan.ChunkCount());
+    RunChunksInParallel(plan, [&](size_t chunk, size_t begin, size_t len) {
+        TLVWriter& writer = out.Writer(chunk);
+        writer.reserve(SerializedSizeHint(src + begin, len, mappingRuleTuple));
+        EncodeTLVRecords(src + begin, len, writer, mappingRuleTuple);
+    });
+    return out.status();
+}
+
+// 将 src[0..count) 编码到 [dst, dst + capacity)，返回写入的字节数，空间不足时返回 0 并将错误码写入 status
+template <typename SrcStruct, typename RuleTuple>
+size_t EncodeTLVRecordsTo(const SrcStruct* src, size_t count, const RuleTuple& mappingRuleTuple, uint8_t* dst,
+                          size_t capacity, int32_t& status)
+{
+    BasicTLVWriter<FixedBufferSink> writer(dst, capacity);
+    EncodeTLVRecords(src, count, writer, mappingRuleTuple);
+    status = writer.status();
+    return status == TLV_OK ? writer.size() : 0;
+}
+
+// 编译期定长：每个结构体的编码长度相同，各分块的区间由元素下标直接得到，
+// 各线程直接编码到 out 中属于自己的区间，不需要计算长度，也不需要最后的拼接拷贝
+template <typename SrcStruct, typename RuleTuple>
+int32_t EncodeTLVChunks(const SrcStruct* src, const RuleTuple& mappingRuleTuple, const ChunkPlan& plan,
+                        std::vector<uint8_t>& out, std::true_type /*fixedSize*/)
+{
+    constexpr size_t recordSize = FixedSerializedSize<SrcStruct, RuleTuple>();
+    size_t base = out.size();
+    out.resize(base + plan.Count() * recordSize);
+    std::vector<int32_t> results(plan.ChunkCount(), TLV_OK);
+    RunChunksInParallel(plan, [&](size_t chunk, size_t begin, size_t len) {
+        EncodeTLVRecordsTo(src + begin, len, mappingRuleTuple, out.data() + base + begin * recordSize,
+                           len * recordSize, results[chunk]);
+    });
+    for (int32_t ret : results) {
+        if (ret != TLV_OK) {
+            return ret;
+        }
+    }
+    return TLV_OK;
+}
+
+// 长度不定：精确长度需要把数字等格式化一遍，编码时还要再格式化一遍，因此只按长度上限预留
+// 只有一个分块且上限可靠（见 ExactSerializedSize）时直接编码到 out 末尾按上限预留的空间，再截断到实际长度；
+// 否则分块编码到从调用线程的对象池取出的写入器，再按顺序拼接
+// 写入器只在调用线程中取出和归还，工作线程只写入各自的写入器，不访问对象池
+template <typename SrcStruct, typename RuleTuple>
+int32_t EncodeTLVChunks(const SrcStruct* src, const RuleTuple& mappingRuleTuple, const ChunkPlan& plan,
+                        std::vector<uint8_t>& out, std::false_type /*fixedSize*/)
+{
+    if (plan.ChunkCount() == 1 && ExactSerializedSize<SrcStruct, RuleTuple>()) {
+        size_t base = out.size();
+        out.resize(base + SerializedSizeHint(src, plan.Count(), mappingRuleTuple));
+        int32_t ret = TLV_OK;
+        out.resize(base + EncodeTLVRecordsTo(src, plan.Count(), mappingRuleTuple, out.data() + base,
+                                             out.size() - base, ret));
+        return ret;
+    }
+
+    TLVWriterPool& pool = TLVWriterPool::ThreadLocal();
+    std::vector<PooledTLVWriter> writers;
+    writers.reserve(plan.ChunkCount());
+    for (size_t i = 0; i < plan.ChunkCount(); ++i) {
+        writers.push_back(pool.Acquire());
+    }
+    RunChunksInParallel(plan, [&](size_t chunk, size_t begin, size_t len) {
+        TLVWriter& writer = writers[chunk].Get();
+        writer.reserve(SerializedSizeHint(src + begin, len, mappingRuleTuple));
+        EncodeTLVRecords(src + begin, len, writer, mappingRuleTuple);
+    });
+
+    size_t total = 0;
+    for (const PooledTLVWriter& writer : writers) {
+        if (writer->status() != TLV_OK) {
+            return writer->status();
+        }
+        total += writer->size();
+    }
+    out.reserve(out.size() + total);
+    for (const PooledTLVWriter& writer : writers) {
+        out.insert(out.end(), writer->data(), writer->data() + writer->size());
+    }
+    return TLV_OK;
+}
+
+// 多线程编码 src[0..count)，每个分块写入 out 中独立的 TLVWriter，返回第一个出错分块的错误码
+// 每个线程至少编码 TLV_PARALLEL_MIN_RECORDS 个结构体，不足时在调用线程中顺序编码
+// 映射规则被多个线程同时调用，自定义转换器需要是无状态或线程安全的
+template <typename SrcStruct, typename RuleTuple>
+int32_t StructFieldsConvertParallel(const SrcStruct* src, size_t count, const RuleTuple& mappingRuleTuple,
+                                    TLVChunkedOutput& out, size_t threadCount)
+{
+    return EncodeTLVChunks(src, mappingRuleTuple, ChunkPlan(count, threadCount, TLV_PARALLEL_MIN_RECORDS), out);
+}
+
+// 多线程编码 src[0..count) 并追加到 out 末尾，输出与顺序编码完全相同；出错时 out 恢复为调用前的长度
+// 编码长度在编译期确定时（见 FixedSerializedSize）各线程直接编码到 out 中预先划分好的区间，
+// 否则按长度上限预留后分块编码再拼接，两种方式都只编码一遍，不单独计算精确长度
+template <typename SrcStruct, typename RuleTuple>
+int32_t StructFieldsConvertParallel(const SrcStruct* src, size_t count, const RuleTuple& mappingRuleTuple,
+                                    std::vector<uint8_t>& out, size_t threadCount)
+{
+    size_t base = out.size();
+    int32_t ret = EncodeTLVChunks(
+        src, mappingRuleTuple, ChunkPlan(count, threadCount, TLV_PARALLEL_MIN_RECORDS), out,
+        std::integral_constant<bool, FixedSerializedSize<SrcStruct, RuleTuple>() != TLV_VARIABLE_SIZE>());
+    if (ret != TLV_OK) {
+        out.resize(base);
+    }
+    return ret;
+}
+
+} // namespace csrl
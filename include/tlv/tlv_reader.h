@@ -0,0 +1,191 @@
+/**
+ * @file tlv_reader.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLV 读取器，用于零拷贝地解析 TLVWriter 输出的 TLV 数据
+ * @version 0.1
+ * @date 2025-07-12
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include "tlv_common.h"
+
+namespace csrl {
+
+// 单条 TLV 记录的只读视图，value 直接指向原始缓冲区，不发生拷贝
+struct TLVRecord {
+    uint32_t type;
+    uint32_t length;
+    const uint8_t* value;
+
+    // 将定长 value 按位拷贝到 out，长度不匹配时返回 false
+    // value 在缓冲区中不保证对齐，因此这里使用 memcpy 而不是 reinterpret_cast
+    template <typename T>
+    bool ValueAs(T& out) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "ValueAs only works with trivially copyable types");
+        if (length != sizeof(T)) {
+            return false;
+        }
+        memcpy(&out, value, sizeof(T));
+        return true;
+    }
+};
+
+// 打包数组的只读视图：value 为 uint32_t 元素个数 + 连续的元素数据，不发生拷贝
+// 元素在缓冲区中不保证对齐，按下标访问时通过 memcpy 取值
+template <typename T>
+class TLVArrayView {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "TLVArrayView only works with trivially copyable types");
+
+    TLVArrayView() = default;
+    TLVArrayView(const uint8_t* data, uint32_t count) : m_data(data), m_count(count) {}
+
+    // 解析 value，元素个数与长度不一致时返回 TLV_ERR_LENGTH_MISMATCH
+    static int32_t Parse(const uint8_t* value, size_t len, TLVArrayView& view)
+    {
+        uint32_t count = 0;
+        if (len < sizeof(count)) {
+            return TLV_ERR_LENGTH_MISMATCH;
+        }
+        memcpy(&count, value, sizeof(count));
+        if ((len - sizeof(count)) / sizeof(T) != count || (len - sizeof(count)) % sizeof(T) != 0) {
+            return TLV_ERR_LENGTH_MISMATCH;
+        }
+        view = TLVArrayView(value + sizeof(count), count);
+        return TLV_OK;
+    }
+
+    T operator[](size_t index) const
+    {
+        T value;
+        memcpy(&value, m_data + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    size_t bytes() const { return m_count * sizeof(T); }
+    const uint8_t* data() const { return m_data; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    uint32_t m_count = 0;
+};
+
+class TLVReader {
+public:
+    // 前向迭代器，每次递增解析下一条记录；遇到越界数据时提前结束，错误码保存在迭代器自身
+    // 迭代器不修改所属的 TLVReader，多个线程可以同时遍历同一个 const TLVReader
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TLVRecord;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const TLVRecord*;
+        using reference = const TLVRecord&;
+
+        Iterator() = default;
+
+        reference operator*() const { return m_record; }
+        pointer operator->() const { return &m_record; }
+
+        Iterator& operator++()
+        {
+            m_offset = m_next;
+            Parse();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const { return m_offset == other.m_offset; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        // 遍历因数据越界提前结束时返回对应的错误码，否则为 TLV_OK
+        int32_t Status() const { return m_status; }
+
+    private:
+        friend class TLVReader;
+
+        Iterator(const TLVReader* reader, size_t offset) : m_reader(reader), m_offset(offset) { Parse(); }
+
+        void Parse()
+        {
+            if (m_offset >= m_reader->m_size) {
+                m_offset = m_reader->m_size;
+                return;
+            }
+            int32_t ret = ParseRecord(m_reader->m_data, m_reader->m_size, m_offset, m_record);
+            if (ret != TLV_OK) {
+                m_status = ret;
+                m_offset = m_reader->m_size;
+                return;
+            }
+            m_next = m_offset + TLV_HEADER_SIZE + m_record.length;
+        }
+
+        const TLVReader* m_reader = nullptr;
+        size_t m_offset = 0;
+        size_t m_next = 0;
+        int32_t m_status = TLV_OK;
+        TLVRecord m_record{0, 0, nullptr};
+    };
+
+    TLVReader(const uint8_t* data, size_t size) : m_data(data), m_size(data == nullptr ? 0 : size) {}
+
+    // 以某条记录的 value 作为新的 TLV 流，用于解析嵌套的子结构体
+    explicit TLVReader(const TLVRecord& record) : TLVReader(record.value, record.length) {}
+
+    Iterator begin() const { return Iterator(this, 0); }
+
+    Iterator end() const { return Iterator(this, m_size); }
+
+    // 解析指定偏移处的一条记录，校验头部和 value 均未越界
+    static int32_t ParseRecord(const uint8_t* data, size_t size, size_t offset, TLVRecord& record)
+    {
+        if (size - offset < TLV_HEADER_SIZE) {
+            return TLV_ERR_TRUNCATED_HEADER;
+        }
+        memcpy(&record.type, data + offset, sizeof(uint32_t));
+        memcpy(&record.length, data + offset + sizeof(uint32_t), sizeof(uint32_t));
+        if (size - offset - TLV_HEADER_SIZE < record.length) {
+            return TLV_ERR_TRUNCATED_VALUE;
+        }
+        record.value = data + offset + TLV_HEADER_SIZE;
+        return TLV_OK;
+    }
+
+    // 只校验记录头而不保存任何状态，数据越界时返回对应的错误码
+    // 遍历过程中的错误可直接通过 Iterator::Status() 获取，无需再次扫描
+    int32_t Status() const
+    {
+        Iterator it = begin();
+        while (it != end()) {
+            ++it;
+        }
+        return it.Status();
+    }
+
+    size_t size() const { return m_size; }
+    const uint8_t* data() const { return m_data; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+};
+
+} // namespace csrl
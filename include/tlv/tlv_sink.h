@@ -0,0 +1,389 @@
+/**
+ * @file tlv_sink.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLV 写入器的输出目标，负责保存 BasicTLVWriter 产生的字节流
+ * @version 0.1
+ * @date 2025-07-19
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "tlv_common.h"
+
+namespace csrl {
+
+// Sink 需要提供的接口（全部通过模板静态分派，不要求继承）：
+//   int32_t Write(const void* data, size_t len);                 追加数据
+//   int32_t Patch(size_t offset, const void* data, size_t len);  覆盖已写入但尚未提交的数据，用于回填嵌套记录的 length
+//   void Truncate(size_t size);                                  丢弃 size 之后尚未提交的数据
+//   int32_t Commit();                                            此前写入的数据不会再被修改，可以向外输出
+//   void Reserve(size_t capacity);                               容量提示，无法扩容的 Sink 可以为空实现
+//   size_t Size() const;                                         已写入的总字节数
+//   void Clear();                                                清空已写入的数据
+// 可选接口：
+//   int32_t WriteRef(const void* data, size_t len);              追加数据但只记录引用，调用方保证 data 在输出完成前有效
+
+// 按容量提示扩容：容量不足时至少扩大一倍，在同一缓冲区上反复按精确长度预留时扩容次数仍为对数级
+inline void ReserveBuffer(std::vector<uint8_t>& buffer, size_t capacity)
+{
+    if (capacity > buffer.capacity()) {
+        buffer.reserve(std::max(capacity, 2 * buffer.capacity()));
+    }
+}
+
+// 自有的可增长缓冲区，TLVWriter 的默认输出目标
+class VectorSink {
+public:
+    explicit VectorSink(size_t initialCapacity = 1024) { m_buffer.reserve(initialCapacity); }
+
+    int32_t Write(const void* data, size_t len)
+    {
+        if (len > 0 && data != nullptr) {
+            const uint8_t* bytePtr = static_cast<const uint8_t*>(data);
+            m_buffer.insert(m_buffer.end(), bytePtr, bytePtr + len);
+        }
+        return TLV_OK;
+    }
+
+    int32_t Patch(size_t offset, const void* data, size_t len)
+    {
+        memcpy(m_buffer.data() + offset, data, len);
+        return TLV_OK;
+    }
+
+    void Truncate(size_t size) { m_buffer.resize(std::min(size, m_buffer.size())); }
+    int32_t Commit() { return TLV_OK; }
+    void Reserve(size_t capacity) { ReserveBuffer(m_buffer, capacity); }
+
+    size_t Size() const { return m_buffer.size(); }
+    size_t Capacity() const { return m_buffer.capacity(); }
+    const uint8_t* Data() const { return m_buffer.data(); }
+    void Clear() { m_buffer.clear(); }
+
+private:
+    std::vector<uint8_t> m_buffer;
+};
+
+// 调用方提供的定长缓冲区，剩余空间不足时返回 TLV_ERR_OVERFLOW 且不写入任何数据
+class FixedBufferSink {
+public:
+    FixedBufferSink(uint8_t* buffer, size_t capacity) : m_data(buffer), m_capacity(buffer == nullptr ? 0 : capacity) {}
+
+    int32_t Write(const void* data, size_t len)
+    {
+        if (len > m_capacity - m_size) {
+            return TLV_ERR_OVERFLOW;
+        }
+        if (len > 0 && data != nullptr) {
+            memcpy(m_data + m_size, data, len);
+        }
+        m_size += len;
+        return TLV_OK;
+    }
+
+    int32_t Patch(size_t offset, const void* data, size_t len)
+    {
+        memcpy(m_data + offset, data, len);
+        return TLV_OK;
+    }
+
+    void Truncate(size_t size) { m_size = std::min(size, m_size); }
+    int32_t Commit() { return TLV_OK; }
+    void Reserve(size_t /*capacity*/) {}
+
+    size_t Size() const { return m_size; }
+    size_t Capacity() const { return m_capacity; }
+    const uint8_t* Data() const { return m_data; }
+    void Clear() { m_size = 0; }
+
+private:
+    uint8_t* m_data;
+    size_t m_capacity;
+    size_t m_size = 0;
+};
+
+// 调用方提供的一组分散缓冲区（如预先注册的网络发送缓冲区），数据按顺序依次填满各段
+// 写完后通过 GetIovecs 得到可直接交给 writev/sendmsg 的 iovec 列表
+class IovecSink {
+public:
+    IovecSink(const struct iovec* iov, size_t iovCount) : m_iov(iov), m_iovCount(iov == nullptr ? 0 : iovCount)
+    {
+        for (size_t i = 0; i < m_iovCount; ++i) {
+            m_capacity += m_iov[i].iov_len;
+        }
+    }
+
+    int32_t Write(const void* data, size_t len)
+    {
+        if (len > m_capacity - m_size) {
+            return TLV_ERR_OVERFLOW;
+        }
+        if (len > 0 && data != nullptr) {
+            CopyAt(m_size, static_cast<const uint8_t*>(data), len);
+        }
+        m_size += len;
+        return TLV_OK;
+    }
+
+    int32_t Patch(size_t offset, const void* data, size_t len)
+    {
+        CopyAt(offset, static_cast<const uint8_t*>(data), len);
+        return TLV_OK;
+    }
+
+    void Truncate(size_t size) { m_size = std::min(size, m_size); }
+    int32_t Commit() { return TLV_OK; }
+    void Reserve(size_t /*capacity*/) {}
+
+    size_t Size() const { return m_size; }
+    size_t Capacity() const { return m_capacity; }
+    void Clear() { m_size = 0; }
+
+    // 输出覆盖已写入数据的 iovec 列表，返回使用的 iovec 个数（不超过 maxCount）
+    size_t GetIovecs(struct iovec* out, size_t maxCount) const
+    {
+        size_t remaining = m_size;
+        size_t count = 0;
+        for (size_t i = 0; i < m_iovCount && remaining > 0 && count < maxCount; ++i) {
+            size_t len = std::min(remaining, m_iov[i].iov_len);
+            if (len == 0) {
+                continue;
+            }
+            out[count].iov_base = m_iov[i].iov_base;
+            out[count].iov_len = len;
+            remaining -= len;
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    // 从逻辑偏移 offset 开始跨段拷贝
+    void CopyAt(size_t offset, const uint8_t* data, size_t len)
+    {
+        size_t index = 0;
+        while (index < m_iovCount && offset >= m_iov[index].iov_len) {
+            offset -= m_iov[index].iov_len;
+            ++index;
+        }
+        while (len > 0 && index < m_iovCount) {
+            size_t copyLen = std::min(len, m_iov[index].iov_len - offset);
+            memcpy(static_cast<uint8_t*>(m_iov[index].iov_base) + offset, data, copyLen);
+            data += copyLen;
+            len -= copyLen;
+            offset = 0;
+            ++index;
+        }
+    }
+
+    const struct iovec* m_iov;
+    size_t m_iovCount;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+};
+
+// 分散/聚集输出：头部、键名等小块数据拷贝到内部缓冲区，通过 WriteRef 写入的大块数据只记录 (指针, 长度)
+// 写完后通过 GetIovecs 得到交替引用内部缓冲区与原始数据的 iovec 列表，可直接交给 writev/sendmsg，省去大块数据的拷贝
+// 被引用的数据（通常是源结构体中的数组）在 iovec 输出完成之前必须保持有效
+class ScatterGatherSink {
+public:
+    explicit ScatterGatherSink(size_t refThreshold = 256, size_t initialCapacity = 1024) : m_refThreshold(refThreshold)
+    {
+        m_inline.reserve(initialCapacity);
+    }
+
+    int32_t Write(const void* data, size_t len)
+    {
+        if (len == 0 || data == nullptr) {
+            return TLV_OK;
+        }
+        if (m_segments.empty() || m_segments.back().ref != nullptr) {
+            m_segments.push_back(Segment{m_size, nullptr, m_inline.size(), 0});
+        }
+        const uint8_t* bytePtr = static_cast<const uint8_t*>(data);
+        m_inline.insert(m_inline.end(), bytePtr, bytePtr + len);
+        m_segments.back().len += len;
+        m_size += len;
+        return TLV_OK;
+    }
+
+    // 不小于 refThreshold 的数据只记录引用，较小的数据拷贝代价低于多一个 iovec，仍然拷贝
+    int32_t WriteRef(const void* data, size_t len)
+    {
+        if (len < m_refThreshold) {
+            return Write(data, len);
+        }
+        m_segments.push_back(Segment{m_size, static_cast<const uint8_t*>(data), m_inline.size(), len});
+        m_size += len;
+        return TLV_OK;
+    }
+
+    // 回填只会发生在头部，头部总是位于内部缓冲区中
+    int32_t Patch(size_t offset, const void* data, size_t len)
+    {
+        const Segment& segment = FindSegment(offset);
+        if (segment.ref != nullptr || offset + len > segment.offset + segment.len) {
+            return TLV_ERR_IO;
+        }
+        memcpy(m_inline.data() + segment.inlineOffset + (offset - segment.offset), data, len);
+        return TLV_OK;
+    }
+
+    void Truncate(size_t size)
+    {
+        while (!m_segments.empty() && m_segments.back().offset >= size) {
+            m_inline.resize(m_segments.back().inlineOffset);
+            m_segments.pop_back();
+        }
+        if (!m_segments.empty() && m_segments.back().offset + m_segments.back().len > size) {
+            Segment& segment = m_segments.back();
+            segment.len = size - segment.offset;
+            if (segment.ref == nullptr) {
+                m_inline.resize(segment.inlineOffset + segment.len);
+            }
+        }
+        m_size = std::min(size, m_size);
+    }
+
+    int32_t Commit() { return TLV_OK; }
+    void Reserve(size_t capacity) { ReserveBuffer(m_inline, capacity); }
+
+    size_t Size() const { return m_size; }
+    size_t InlineSize() const { return m_inline.size(); }
+
+    void Clear()
+    {
+        m_inline.clear();
+        m_segments.clear();
+        m_size = 0;
+    }
+
+    size_t IovecCount() const { return m_segments.size(); }
+
+    // 输出按顺序覆盖全部数据的 iovec 列表，返回使用的 iovec 个数（不超过 maxCount）
+    // 指向内部缓冲区的 iovec 在下一次写入前有效
+    size_t GetIovecs(struct iovec* out, size_t maxCount) const
+    {
+        size_t count = std::min(maxCount, m_segments.size());
+        for (size_t i = 0; i < count; ++i) {
+            const Segment& segment = m_segments[i];
+            const uint8_t* base = segment.ref != nullptr ? segment.ref : m_inline.data() + segment.inlineOffset;
+            out[i].iov_base = const_cast<uint8_t*>(base);
+            out[i].iov_len = segment.len;
+        }
+        return count;
+    }
+
+private:
+    // offset 为逻辑偏移；ref 为空时数据位于内部缓冲区的 inlineOffset 处
+    struct Segment {
+        size_t offset;
+        const uint8_t* ref;
+        size_t inlineOffset;
+        size_t len;
+    };
+
+    // 查找包含逻辑偏移 offset 的数据段，调用方保证 offset 小于 Size()
+    const Segment& FindSegment(size_t offset) const
+    {
+        auto it = std::upper_bound(m_segments.begin(), m_segments.end(), offset,
+                                   [](size_t value, const Segment& segment) { return value < segment.offset; });
+        return *(it - 1);
+    }
+
+    size_t m_refThreshold;
+    size_t m_size = 0;
+    std::vector<uint8_t> m_inline;
+    std::vector<Segment> m_segments;
+};
+
+// 直接写入文件描述符（文件、管道或 socket），数据先在内部缓冲，提交后累计达到 chunkSize 时整块写出
+// 嵌套记录未结束时不会提交，保证回填 length 时数据仍在缓冲区中
+// 调用方需要在结束写入后显式调用 Flush() 并检查返回值；析构时只是尽力写出剩余数据，无法报告错误
+class FdSink {
+public:
+    explicit FdSink(int fd, size_t chunkSize = 64 * 1024) : m_fd(fd), m_chunkSize(chunkSize)
+    {
+        m_buffer.reserve(chunkSize);
+    }
+
+    FdSink(const FdSink&) = delete;
+    FdSink& operator=(const FdSink&) = delete;
+
+    ~FdSink() { (void)Flush(); }
+
+    int32_t Write(const void* data, size_t len)
+    {
+        if (len > 0 && data != nullptr) {
+            const uint8_t* bytePtr = static_cast<const uint8_t*>(data);
+            m_buffer.insert(m_buffer.end(), bytePtr, bytePtr + len);
+        }
+        return TLV_OK;
+    }
+
+    int32_t Patch(size_t offset, const void* data, size_t len)
+    {
+        if (offset < m_flushed) {
+            return TLV_ERR_IO;
+        }
+        memcpy(m_buffer.data() + (offset - m_flushed), data, len);
+        return TLV_OK;
+    }
+
+    void Truncate(size_t size)
+    {
+        if (size >= m_flushed) {
+            m_buffer.resize(std::min(size - m_flushed, m_buffer.size()));
+        }
+    }
+
+    int32_t Commit() { return m_buffer.size() >= m_chunkSize ? Flush() : TLV_OK; }
+    void Reserve(size_t /*capacity*/) {}
+
+    // 将缓冲区中的全部数据写入文件描述符，处理部分写入与 EINTR
+    int32_t Flush()
+    {
+        size_t offset = 0;
+        while (offset < m_buffer.size()) {
+            ssize_t written = ::write(m_fd, m_buffer.data() + offset, m_buffer.size() - offset);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                m_buffer.erase(m_buffer.begin(), m_buffer.begin() + offset);
+                m_flushed += offset;
+                return TLV_ERR_IO;
+            }
+            offset += static_cast<size_t>(written);
+        }
+        m_flushed += offset;
+        m_buffer.clear();
+        return TLV_OK;
+    }
+
+    size_t Size() const { return m_flushed + m_buffer.size(); }
+    // 丢弃尚未写出的数据，之后的大小与偏移从 0 重新计算
+    void Clear()
+    {
+        m_buffer.clear();
+        m_flushed = 0;
+    }
+
+private:
+    int m_fd;
+    size_t m_chunkSize;
+    size_t m_flushed = 0;
+    std::vector<uint8_t> m_buffer;
+};
+
+} // namespace csrl
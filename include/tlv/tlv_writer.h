@@ -14,6 +14,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
+#include <memory>
 #include <new>
 #include <utility>
 #include <type_traits>
@@ -22,15 +24,34 @@
 #include "field_mapping.h"
 #include "field_convert.h"
 #include "define_type_traits.h"
+#include "tlv_reader.h"
+#include "tlv_sink.h"
+#include "number_format.h"
+#include "perfect_hash.h"
+#include "variable_length_array.h"
+#include "yyjson.h"
 
 namespace csrl {
 
-class TLVWriter {
+// 检测 Sink 是否支持只记录引用的 WriteRef
+template <typename Sink, typename = void>
+struct TLVSinkHasWriteRef : std::false_type {};
+
+template <typename Sink>
+struct TLVSinkHasWriteRef<Sink, void_t<decltype(std::declval<Sink&>().WriteRef(std::declval<const void*>(), size_t(0)))>>
+    : std::true_type {};
+
+// TLV 写入器，Sink 决定数据的输出目标（见 tlv_sink.h）
+// 写入失败时撤销当前记录（包括所有未结束的嵌套记录），并将错误码保存在 status() 中
+// 出错后不再写入任何数据，直到 clear()，因此转换器无需逐条检查返回值
+template <typename Sink>
+class BasicTLVWriter {
 public:
-    explicit TLVWriter(size_t initialCapacity = 1024) { m_buffer.reserve(initialCapacity); }
+    template <typename... Args>
+    explicit BasicTLVWriter(Args&&... args) : m_sink(std::forward<Args>(args)...) {}
 
-    TLVWriter(const TLVWriter&) = delete;
-    TLVWriter& operator=(const TLVWriter&) = delete;
+    BasicTLVWriter(const BasicTLVWriter&) = delete;
+    BasicTLVWriter& operator=(const BasicTLVWriter&) = delete;
 
     // AppendBuf 接口：仅传入一段数据
     int32_t AppendBuf(uint32_t type, const char* buf, size_t len) 
@@ -44,9 +65,105 @@ public:
         return Append(type, firstBuf, firstLen, secBuf, secLen);
     }
 
-    size_t size() const { return m_buffer.size(); }
-    const uint8_t* data() const { return m_buffer.data(); }
-    void clear() { m_buffer.clear(); }
+    // 与 AppendBuf/AppendPair 相同，但最后一段数据在 Sink 支持时只记录引用而不拷贝（见 ScatterGatherSink）
+    // 调用方保证 buf 在输出完成前有效，不支持引用的 Sink 退化为普通拷贝
+    int32_t AppendBufRef(uint32_t type, const char* buf, size_t len)
+    {
+        return AppendRef(type, nullptr, 0, buf, len);
+    }
+
+    int32_t AppendPairRef(uint32_t type, const char* firstBuf, size_t firstLen, const char* secBuf, size_t secLen)
+    {
+        return AppendRef(type, firstBuf, firstLen, secBuf, secLen);
+    }
+
+    // 写入调用方已编码好的记录头（type、length 以及可选的键名等），随后写入 value
+    // 记录头为编译期定长时一次写入，避免逐段写入；header 中的 length 必须与实际写入的字节数一致
+    int32_t AppendEncoded(const void* header, size_t headerLen, const char* buf, size_t len)
+    {
+        return AppendEncoded(header, headerLen, buf, len, std::false_type());
+    }
+
+    // 与 AppendEncoded 相同，value 在 Sink 支持时只记录引用
+    int32_t AppendEncodedRef(const void* header, size_t headerLen, const char* buf, size_t len)
+    {
+        return AppendEncoded(header, headerLen, buf, len, TLVSinkHasWriteRef<Sink>());
+    }
+
+    size_t size() const { return m_sink.Size(); }
+    const uint8_t* data() const { return m_sink.Data(); }
+
+    void clear()
+    {
+        m_sink.Clear();
+        m_openRecords = 0;
+        m_status = TLV_OK;
+    }
+
+    // 开始一条嵌套记录：写入 type、占位的 length 以及可选的键名，返回记录起始偏移
+    // 之后追加的数据都属于该记录的 value，由 EndRecord 回填 length 或由 AbortRecord 撤销
+    size_t BeginRecord(uint32_t type, const char* keyName = nullptr, size_t keyLen = 0)
+    {
+        size_t recordOffset = m_sink.Size();
+        ++m_openRecords;
+        if (m_status != TLV_OK) {
+            return recordOffset;
+        }
+        uint32_t placeholder = 0;
+        int32_t ret = WriteSegments(&type, sizeof(type), &placeholder, sizeof(placeholder), keyName, keyLen);
+        if (ret != TLV_OK) {
+            m_sink.Truncate(recordOffset);
+            SetStatus(ret);
+        }
+        return recordOffset;
+    }
+
+    // 与 BeginRecord 相同，记录头（type、占位 length 与键名）由调用方编码好后一次写入
+    size_t BeginEncodedRecord(const void* header, size_t headerLen)
+    {
+        size_t recordOffset = m_sink.Size();
+        ++m_openRecords;
+        if (m_status != TLV_OK) {
+            return recordOffset;
+        }
+        int32_t ret = m_sink.Write(header, headerLen);
+        if (ret != TLV_OK) {
+            m_sink.Truncate(recordOffset);
+            SetStatus(ret);
+        }
+        return recordOffset;
+    }
+
+    // 结束嵌套记录：将 BeginRecord 之后写入的字节数回填到 length
+    void EndRecord(size_t recordOffset)
+    {
+        if (m_status != TLV_OK) {
+            AbortRecord(recordOffset);
+            return;
+        }
+        --m_openRecords;
+        uint32_t valueLen = static_cast<uint32_t>(m_sink.Size() - recordOffset - TLV_HEADER_SIZE);
+        SetStatus(m_sink.Patch(recordOffset + sizeof(uint32_t), &valueLen, sizeof(valueLen)));
+        CommitIfClosed();
+    }
+
+    // 撤销 BeginRecord 开始的记录及其之后写入的数据
+    void AbortRecord(size_t recordOffset)
+    {
+        --m_openRecords;
+        m_sink.Truncate(recordOffset);
+        CommitIfClosed();
+    }
+
+    // 预留至少 capacity 字节的总容量，配合 SerializedSize 可一次性分配到位
+    void reserve(size_t capacity) { m_sink.Reserve(capacity); }
+    size_t capacity() const { return m_sink.Capacity(); }
+
+    // 写入错误码，未出错时为 TLV_OK
+    int32_t status() const { return m_status; }
+
+    Sink& sink() { return m_sink; }
+    const Sink& sink() const { return m_sink; }
 
 private:
     // 递归计算各段长度（要求参数必须成对：指针和长度）
@@ -58,25 +175,45 @@ private:
         return len + TotalLength(std::forward<Rest>(rest)...);
     }
 
-    // 辅助函数：将数据追加到 buffer
-    void AppendToBuffer(const uint8_t* data, size_t len) 
+    // 递归写入各段数据到 Sink
+    int32_t WriteSegments() { return TLV_OK; }
+
+    template <typename Ptr, typename Len, typename... Rest>
+    int32_t WriteSegments(const Ptr buf, Len len, Rest&&... rest) 
     {
-        if (len > 0 && data != nullptr) {
-            m_buffer.insert(m_buffer.end(), data, data + len);
+        if (len > 0 && buf != nullptr) {
+            int32_t ret = m_sink.Write(buf, len);
+            if (ret != TLV_OK) {
+                return ret;
+            }
         }
+        return WriteSegments(std::forward<Rest>(rest)...);
+    }
+
+    int32_t WriteRef(const void* buf, size_t len, std::true_type /*hasWriteRef*/)
+    {
+        return m_sink.WriteRef(buf, len);
     }
 
-    // 递归写入各段数据到 buffer
-    void AppendSegmentsToBuffer() {}
+    int32_t WriteRef(const void* buf, size_t len, std::false_type /*hasWriteRef*/)
+    {
+        return m_sink.Write(buf, len);
+    }
 
-    template <typename Ptr, typename Len, typename... Rest>
-    void AppendSegmentsToBuffer(const Ptr buf, Len len, Rest&&... rest) 
+    int32_t SetStatus(int32_t ret)
     {
-        if (len > 0 && buf != nullptr) {
-            const uint8_t* bytePtr = reinterpret_cast<const uint8_t*>(buf);
-            m_buffer.insert(m_buffer.end(), bytePtr, bytePtr + len);
+        if (m_status == TLV_OK) {
+            m_status = ret;
+        }
+        return m_status;
+    }
+
+    // 没有未结束的嵌套记录时提交数据，允许 Sink 向外输出；提交失败时记录到 m_status，由调用方返回
+    void CommitIfClosed()
+    {
+        if (m_openRecords == 0) {
+            SetStatus(m_sink.Commit());
         }
-        AppendSegmentsToBuffer(std::forward<Rest>(rest)...);
     }
 
     // 通用的追加接口：
@@ -86,40 +223,66 @@ private:
     {
         static_assert(sizeof...(Args) % 2 == 0, "Buffer segments must come in pairs: pointer and length.");
         
-        // 先写入 type
-        AppendToBuffer(reinterpret_cast<const uint8_t*>(&type), sizeof(type));
-        
-        // 计算并写入总长度
-        size_t segmentsLen = TotalLength(std::forward<Args>(args)...);
-        uint32_t valueLen = static_cast<uint32_t>(segmentsLen);
-        AppendToBuffer(reinterpret_cast<const uint8_t*>(&valueLen), sizeof(valueLen));
-        
-        // 递归写入各段数据
-        AppendSegmentsToBuffer(std::forward<Args>(args)...);
-        
-        return 0;
+        // 计算总长度，与 type 一起作为头部写入，随后递归写入各段数据
+        if (m_status != TLV_OK) {
+            return m_status;
+        }
+        size_t recordOffset = m_sink.Size();
+        uint32_t valueLen = static_cast<uint32_t>(TotalLength(std::forward<Args>(args)...));
+        int32_t ret = WriteSegments(&type, sizeof(type), &valueLen, sizeof(valueLen), std::forward<Args>(args)...);
+        if (ret != TLV_OK) {
+            m_sink.Truncate(recordOffset);
+            return SetStatus(ret);
+        }
+        CommitIfClosed();
+        return m_status;
     }
 
-    std::vector<uint8_t> m_buffer;
-};
+    int32_t AppendRef(uint32_t type, const char* firstBuf, size_t firstLen, const char* refBuf, size_t refLen)
+    {
+        if (m_status != TLV_OK) {
+            return m_status;
+        }
+        size_t recordOffset = m_sink.Size();
+        uint32_t valueLen = static_cast<uint32_t>(firstLen + refLen);
+        int32_t ret = WriteSegments(&type, sizeof(type), &valueLen, sizeof(valueLen), firstBuf, firstLen);
+        if (ret == TLV_OK && refLen > 0 && refBuf != nullptr) {
+            ret = WriteRef(refBuf, refLen, TLVSinkHasWriteRef<Sink>());
+        }
+        if (ret != TLV_OK) {
+            m_sink.Truncate(recordOffset);
+            return SetStatus(ret);
+        }
+        CommitIfClosed();
+        return m_status;
+    }
 
-// 用于包装可变长C风格数组的结构
-template<typename T>
-struct VariableLengthArray {
-    uint32_t length;      // 实际元素个数
-    const T* data;        // 数组指针
-    size_t maxSize;       // 数组最大容量（可选，用于安全检查）
-    
-    VariableLengthArray(uint32_t len, const T* arr, size_t max = 0) 
-        : length(len), data(arr), maxSize(max) {}
+    template <typename RefTag>
+    int32_t AppendEncoded(const void* header, size_t headerLen, const char* buf, size_t len, RefTag refTag)
+    {
+        if (m_status != TLV_OK) {
+            return m_status;
+        }
+        size_t recordOffset = m_sink.Size();
+        int32_t ret = m_sink.Write(header, headerLen);
+        if (ret == TLV_OK && len > 0 && buf != nullptr) {
+            ret = WriteRef(buf, len, refTag);
+        }
+        if (ret != TLV_OK) {
+            m_sink.Truncate(recordOffset);
+            return SetStatus(ret);
+        }
+        CommitIfClosed();
+        return m_status;
+    }
+
+    Sink m_sink;
+    size_t m_openRecords = 0;
+    int32_t m_status = TLV_OK;
 };
 
-// 辅助函数：创建可变长数组包装
-template<typename T, size_t N>
-VariableLengthArray<T> MakeVariableLengthArray(uint32_t length, const T (&array)[N])
-{
-    return VariableLengthArray<T>(std::min(length, static_cast<uint32_t>(N)), array, N);
-}
+// 默认的 TLV 写入器，输出到自有的可增长缓冲区
+using TLVWriter = BasicTLVWriter<VectorSink>;
 
 template<std::size_t LengthIndex, std::size_t ArrayIndex>
 struct VariableLengthArrayExtractor {
@@ -132,77 +295,405 @@ struct VariableLengthArrayExtractor {
     }
 };
 
+// 表示序列化长度依赖运行期数据，无法在编译期确定
+constexpr size_t TLV_VARIABLE_SIZE = std::numeric_limits<size_t>::max();
+
+// 编译期计算以 '\0' 结尾的字符串长度（包含结尾的 '\0'），空指针返回 0
+constexpr size_t TLVKeySize(const char* key)
+{
+    if (key == nullptr) {
+        return 0;
+    }
+    size_t len = 0;
+    while (key[len] != '\0') {
+        ++len;
+    }
+    return len + 1;
+}
+
+// 前向声明：计算按映射规则序列化后的总字节数
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSize(const SrcStruct& src, const RuleTuple& mappingRuleTuple);
+
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSizeHint(const SrcStruct& src, const RuleTuple& mappingRuleTuple);
+
+template <typename SrcStruct, typename RuleTuple>
+constexpr size_t FixedSerializedSize();
+
+template <typename SrcStruct, typename RuleTuple>
+constexpr bool ExactSerializedSize();
+
+// 键名长度能否在编译期确定：在其他编译单元中定义的 extern 键名（如 extern const char kKey[];）不是常量表达式
+template<const char* key, typename = void>
+struct TLVConstantKey : std::false_type {
+    static constexpr size_t m_size = 0;
+};
+
+template<const char* key>
+struct TLVConstantKey<key, void_t<std::integral_constant<size_t, TLVKeySize(key)>>> : std::true_type {
+    static constexpr size_t m_size = TLVKeySize(key);
+};
+
 // TLV 转换器基类
 template<uint32_t tlvType, const char* keyName = nullptr>
 struct BaseTLVConverter {
     static constexpr uint32_t m_tlvType = tlvType;
     static constexpr const char* m_keyName = keyName;
+    // 键名长度是否为编译期常量，否则 m_keySize 为 0，记录头与键名在运行期逐段写入
+    using ConstantKey = TLVConstantKey<keyName>;
+    static constexpr size_t m_keySize = ConstantKey::m_size;
+    // 记录头与键名的总长度，编译期确定
+    static constexpr size_t m_headerSize = TLV_HEADER_SIZE + m_keySize;
+    // operator() 直接接受 BasicTLVWriter<Sink>&（见 TLVConverterTakesWriter）
+    static constexpr bool m_takesWriter = true;
+    // 是否带键名，按此标签分派，无键名时不会生成任何访问键名的代码
+    using HasKey = std::integral_constant<bool, (keyName != nullptr)>;
 
-    template<typename SrcType>
-    void operator()(const SrcType& src, std::shared_ptr<TLVWriter>& dst) const 
+    // 键名（包含结尾的 '\0'）的字节数，键名不是常量表达式时在运行期计算
+    static size_t KeySize() { return ConstantKey::value ? m_keySize : TLVKeySize(m_keyName); }
+
+    // 编码记录头与键名，valueLen 为键名之后 value 的字节数
+    // 长度均为编译期常量，拷贝会被展开为定长的存储指令，不再对键名调用 strlen
+    static void EncodeHeader(uint8_t* header, size_t valueLen)
+    {
+        uint32_t type = m_tlvType;
+        uint32_t length = static_cast<uint32_t>(m_keySize + valueLen);
+        memcpy(header, &type, sizeof(type));
+        memcpy(header + sizeof(type), &length, sizeof(length));
+        EncodeKey(header + TLV_HEADER_SIZE, HasKey());
+    }
+
+    static void EncodeKey(uint8_t* dst, std::true_type /*hasKey*/) { memcpy(dst, m_keyName, m_keySize); }
+    static void EncodeKey(uint8_t* /*dst*/, std::false_type /*hasKey*/) {}
+
+    // 写入一条完整的记录，键名长度为编译期常量时记录头与键名编码后一次写入
+    template<typename Sink>
+    static void AppendRecord(BasicTLVWriter<Sink>& dst, const char* value, size_t len)
+    {
+        AppendRecord(dst, value, len, ConstantKey(), std::false_type());
+    }
+
+    // 与 AppendRecord 相同，value 在 Sink 支持时只记录引用
+    template<typename Sink>
+    static void AppendRecordRef(BasicTLVWriter<Sink>& dst, const char* value, size_t len)
+    {
+        AppendRecord(dst, value, len, ConstantKey(), std::true_type());
+    }
+
+    template<typename Sink, typename Ref>
+    static void AppendRecord(BasicTLVWriter<Sink>& dst, const char* value, size_t len, std::true_type /*constantKey*/, Ref)
     {
-        if (m_keyName == nullptr) {
-            dst->AppendBuf(m_tlvType, reinterpret_cast<const char*>(&src), sizeof(src));
+        uint8_t header[m_headerSize];
+        EncodeHeader(header, len);
+        if (Ref::value) {
+            dst.AppendEncodedRef(header, sizeof(header), value, len);
         } else {
-            dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, reinterpret_cast<const char*>(&src), sizeof(src));
+            dst.AppendEncoded(header, sizeof(header), value, len);
         }
     }
 
-    // C 风格字符数组特化
-    template<size_t N>
-    void operator()(const char (&src)[N], std::shared_ptr<TLVWriter>& dst) const 
+    template<typename Sink, typename Ref>
+    static void AppendRecord(BasicTLVWriter<Sink>& dst, const char* value, size_t len, std::false_type /*constantKey*/, Ref)
     {
-        if (m_keyName == nullptr) {
-            dst->AppendBuf(m_tlvType, src, strlen(src) + 1);
+        if (Ref::value) {
+            dst.AppendPairRef(m_tlvType, m_keyName, KeySize(), value, len);
         } else {
-            dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, src, strlen(src) + 1);
+            dst.AppendPair(m_tlvType, m_keyName, KeySize(), value, len);
         }
     }
 
-    // C 风格非字符数组特化 (如 int[5])
-    template<typename T, size_t N>
+    // 开始一条嵌套记录（见 BasicTLVWriter::BeginRecord），返回记录起始偏移
+    template<typename Sink>
+    static size_t BeginRecord(BasicTLVWriter<Sink>& dst)
+    {
+        return BeginRecord(dst, ConstantKey());
+    }
+
+    template<typename Sink>
+    static size_t BeginRecord(BasicTLVWriter<Sink>& dst, std::true_type /*constantKey*/)
+    {
+        uint8_t header[m_headerSize];
+        EncodeHeader(header, 0);
+        return dst.BeginEncodedRecord(header, sizeof(header));
+    }
+
+    template<typename Sink>
+    static size_t BeginRecord(BasicTLVWriter<Sink>& dst, std::false_type /*constantKey*/)
+    {
+        return dst.BeginRecord(m_tlvType, m_keyName, KeySize());
+    }
+
+    template<typename SrcType, typename Sink>
+    void operator()(const SrcType& src, BasicTLVWriter<Sink>& dst) const 
+    {
+        AppendRecord(dst, reinterpret_cast<const char*>(&src), sizeof(src));
+    }
+
+    // C 风格字符数组特化
+    template<size_t N, typename Sink>
+    void operator()(const char (&src)[N], BasicTLVWriter<Sink>& dst) const 
+    {
+        AppendRecord(dst, src, strlen(src) + 1);
+    }
+
+    // C 风格非字符数组特化 (如 int[5])，数组总是位于源结构体中，value 以引用方式写入，支持引用的 Sink 不再拷贝
+    template<typename T, size_t N, typename Sink>
     typename std::enable_if<!std::is_same<T, char>::value, void>::type
-    operator()(const T (&src)[N], std::shared_ptr<TLVWriter>& dst) const 
+    operator()(const T (&src)[N], BasicTLVWriter<Sink>& dst) const 
     {
-        if (m_keyName == nullptr) {
-            dst->AppendBuf(m_tlvType, reinterpret_cast<const char*>(src), sizeof(src));
-        } else {
-            dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, 
-                           reinterpret_cast<const char*>(src), sizeof(src));
-        }
+        AppendRecordRef(dst, reinterpret_cast<const char*>(src), sizeof(src));
     }
 
     // 可变长数组特化
-    template<typename T>
-    void operator()(const VariableLengthArray<T>& src, std::shared_ptr<TLVWriter>& dst) const
+    template<typename T, typename Sink>
+    void operator()(const VariableLengthArray<T>& src, BasicTLVWriter<Sink>& dst) const
     {
         for (size_t i = 0; i < src.length; ++i) {
-            if (m_keyName == nullptr) {
-                dst->AppendBuf(m_tlvType, reinterpret_cast<const char*>(&src.data[i]), sizeof(src.data[i]));
-            } else {
-                dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, 
-                               reinterpret_cast<const char*>(&src.data[i]), sizeof(src.data[i]));
-            }
+            AppendRecord(dst, reinterpret_cast<const char*>(&src.data[i]), sizeof(T));
         }
     }
+
+    // 计算序列化后的字节数，与 operator() 的输出保持一致
+    template<typename SrcType>
+    size_t SerializedSize(const SrcType& /*src*/) const
+    {
+        return TLV_HEADER_SIZE + KeySize() + sizeof(SrcType);
+    }
+
+    template<size_t N>
+    size_t SerializedSize(const char (&src)[N]) const
+    {
+        return TLV_HEADER_SIZE + KeySize() + strlen(src) + 1;
+    }
+
+    template<typename T>
+    size_t SerializedSize(const VariableLengthArray<T>& src) const
+    {
+        return src.length * (TLV_HEADER_SIZE + KeySize() + sizeof(T));
+    }
+
+    // 编译期计算序列化后的字节数，长度依赖运行期数据时返回 TLV_VARIABLE_SIZE
+    template<typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        return std::is_same<typename std::remove_extent<SrcType>::type, char>::value || !ConstantKey::value
+                   ? TLV_VARIABLE_SIZE
+                   : TLV_HEADER_SIZE + m_keySize + sizeof(SrcType);
+    }
+
+    // SerializedSize 是否为精确长度，只有包含未实现 SerializedSize 的自定义转换器时才是下界
+    template<typename SrcType>
+    static constexpr bool ExactSerializedSize()
+    {
+        return true;
+    }
+
+    // 反序列化：跳过 value 开头的键名，输出剩余的值部分
+    static int32_t SkipKey(const TLVRecord& record, const uint8_t*& value, size_t& len)
+    {
+        value = record.value;
+        len = record.length;
+        return SkipKey(value, len, HasKey());
+    }
+
+    static int32_t SkipKey(const uint8_t*& value, size_t& len, std::true_type /*hasKey*/)
+    {
+        size_t keySize = KeySize();
+        if (len < keySize || memcmp(value, m_keyName, keySize) != 0) {
+            return TLV_ERR_KEY_MISMATCH;
+        }
+        value += keySize;
+        len -= keySize;
+        return TLV_OK;
+    }
+
+    static int32_t SkipKey(const uint8_t*& /*value*/, size_t& /*len*/, std::false_type /*hasKey*/) { return TLV_OK; }
+
+    // 反序列化：定长类型按位拷贝，index 为该规则已解析的记录数，标量字段忽略
+    template<typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t /*index*/) const
+    {
+        static_assert(std::is_trivially_copyable<DstType>::value, "BaseTLVConverter only decodes trivially copyable types");
+        const uint8_t* value = nullptr;
+        size_t len = 0;
+        int32_t ret = SkipKey(record, value, len);
+        if (ret != TLV_OK) {
+            return ret;
+        }
+        if (len != sizeof(DstType)) {
+            return TLV_ERR_LENGTH_MISMATCH;
+        }
+        memcpy(&dst, value, len);
+        return TLV_OK;
+    }
+
+    // 反序列化 C 风格字符数组，超出容量的部分被截断，结果始终以 '\0' 结尾
+    template<size_t N>
+    int32_t Decode(const TLVRecord& record, char (&dst)[N], size_t /*index*/) const
+    {
+        const uint8_t* value = nullptr;
+        size_t len = 0;
+        int32_t ret = SkipKey(record, value, len);
+        if (ret != TLV_OK) {
+            return ret;
+        }
+        size_t copyLen = std::min(len, N - 1);
+        memcpy(dst, value, copyLen);
+        dst[copyLen] = '\0';
+        return TLV_OK;
+    }
 };
 
 // 数字转字符串 TLV 转换器
 template <uint32_t TLVType, const char* KeyName = nullptr>
 struct DigitalToStringTLVConverter : public BaseTLVConverter<TLVType, KeyName> {
-    using BaseTLVConverter<TLVType, KeyName>::m_keyName;
     using BaseTLVConverter<TLVType, KeyName>::m_tlvType;
 
+    template <typename SrcType, typename Sink>
+    void operator()(const SrcType& src, BasicTLVWriter<Sink>& dst) const 
+    {
+        static_assert(std::is_arithmetic<SrcType>::value, "DigitalToStringTLVConverter only works with arithmetic types");
+        // 在栈上格式化后直接写入，不构造临时字符串
+        char buf[NUMBER_BUFFER_SIZE];
+        size_t len = 0;
+        const char* text = Format(src, buf, len, std::is_floating_point<SrcType>());
+        BaseTLVConverter<TLVType, KeyName>::AppendRecord(dst, text, len);
+    }
+
     template <typename SrcType>
-    void operator()(const SrcType& src, std::shared_ptr<TLVWriter>& dst) const 
+    size_t SerializedSize(const SrcType& src) const
     {
-        static_assert(std::is_integral<SrcType>::value, "DigitalToStringTLVConverter only works with integral types");
-        std::string valueStr = std::to_string(src);
-        if (m_keyName == nullptr) {
-            dst->AppendBuf(m_tlvType, valueStr.c_str(), valueStr.length());
-        } else {
-            dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, valueStr.c_str(), valueStr.length());
+        return TLV_HEADER_SIZE + BaseTLVConverter<TLVType, KeyName>::KeySize() + TextSize(src, std::is_floating_point<SrcType>());
+    }
+
+    // 预留容量使用的长度上限：浮点数按最长文本计算，避免为了预留而格式化一次、写入时再格式化一次
+    template <typename SrcType>
+    size_t SerializedSizeHint(const SrcType& src) const
+    {
+        return std::is_floating_point<SrcType>::value
+                   ? TLV_HEADER_SIZE + BaseTLVConverter<TLVType, KeyName>::KeySize() + FLOAT_TEXT_MAX_SIZE
+                   : SerializedSize(src);
+    }
+
+    template <typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        return TLV_VARIABLE_SIZE;
+    }
+
+    // 反序列化：将十进制字符串解析为数字，越界或格式非法时返回错误
+    template <typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t /*index*/) const
+    {
+        static_assert(std::is_arithmetic<DstType>::value, "DigitalToStringTLVConverter only works with arithmetic types");
+        const uint8_t* value = nullptr;
+        size_t len = 0;
+        int32_t ret = BaseTLVConverter<TLVType, KeyName>::SkipKey(record, value, len);
+        if (ret != TLV_OK) {
+            return ret;
         }
+        return Parse(value, len, dst, std::is_floating_point<DstType>());
+    }
+
+private:
+    // 整数：按两位一组从缓冲区末尾向前写入
+    template <typename SrcType>
+    static const char* Format(SrcType src, char (&buf)[NUMBER_BUFFER_SIZE], size_t& len, std::false_type)
+    {
+        char* begin = FormatDecimal(src, buf + NUMBER_BUFFER_SIZE);
+        len = static_cast<size_t>(buf + NUMBER_BUFFER_SIZE - begin);
+        return begin;
+    }
+
+    // bool 按整数 0、1 输出
+    static const char* Format(bool src, char (&buf)[NUMBER_BUFFER_SIZE], size_t& len, std::false_type)
+    {
+        return Format(static_cast<unsigned int>(src), buf, len, std::false_type());
+    }
+
+    // 浮点数：按自身精度输出最短往返格式（float 不会输出 double 的误差位），NaN 与无穷大输出为 NaN、Infinity
+    template <typename SrcType>
+    static const char* Format(SrcType src, char (&buf)[NUMBER_BUFFER_SIZE], size_t& len, std::true_type)
+    {
+        len = FormatShortest(src, buf, YYJSON_WRITE_ALLOW_INF_AND_NAN);
+        return buf;
+    }
+
+    template <typename SrcType>
+    static size_t TextSize(SrcType src, std::false_type)
+    {
+        return DecimalDigitCount(src);
+    }
+
+    static size_t TextSize(bool /*src*/, std::false_type) { return 1; }
+
+    template <typename SrcType>
+    static size_t TextSize(SrcType src, std::true_type)
+    {
+        char buf[NUMBER_BUFFER_SIZE];
+        size_t len = 0;
+        Format(src, buf, len, std::true_type());
+        return len;
+    }
+
+    template <typename DstType>
+    static int32_t Parse(const uint8_t* value, size_t len, DstType& dst, std::true_type)
+    {
+        // yyjson 要求以 '\0' 结尾，先拷贝到栈缓冲区
+        char buf[NUMBER_BUFFER_SIZE];
+        if (len == 0 || len >= sizeof(buf)) {
+            return TLV_ERR_INVALID_VALUE;
+        }
+        memcpy(buf, value, len);
+        buf[len] = '\0';
+        yyjson_val number = {};
+        const char* end = yyjson_read_number(buf, &number, YYJSON_READ_ALLOW_INF_AND_NAN, nullptr, nullptr);
+        if (end != buf + len) {
+            return TLV_ERR_INVALID_VALUE;
+        }
+        dst = static_cast<DstType>(yyjson_get_num(&number));
+        return TLV_OK;
+    }
+
+    // bool 只接受 0、1
+    static int32_t Parse(const uint8_t* value, size_t len, bool& dst, std::false_type)
+    {
+        unsigned int number = 0;
+        int32_t ret = Parse(value, len, number, std::false_type());
+        if (ret != TLV_OK || number > 1) {
+            return TLV_ERR_INVALID_VALUE;
+        }
+        dst = (number != 0);
+        return TLV_OK;
+    }
+
+    template <typename DstType>
+    static int32_t Parse(const uint8_t* value, size_t len, DstType& dst, std::false_type)
+    {
+        bool negative = (len > 0 && value[0] == '-');
+        size_t pos = negative ? 1 : 0;
+        if (pos == len || (negative && !std::is_signed<DstType>::value)) {
+            return TLV_ERR_INVALID_VALUE;
+        }
+
+        // 以无符号数累加绝对值，负数允许比正数多 1 的绝对值
+        using UnsignedType = typename std::make_unsigned<DstType>::type;
+        const UnsignedType limit = negative ? static_cast<UnsignedType>(std::numeric_limits<DstType>::max()) + 1
+                                            : static_cast<UnsignedType>(std::numeric_limits<DstType>::max());
+        UnsignedType magnitude = 0;
+        for (; pos < len; ++pos) {
+            if (value[pos] < '0' || value[pos] > '9') {
+                return TLV_ERR_INVALID_VALUE;
+            }
+            UnsignedType digit = static_cast<UnsignedType>(value[pos] - '0');
+            if (magnitude > (limit - digit) / 10) {
+                return TLV_ERR_INVALID_VALUE;
+            }
+            magnitude = static_cast<UnsignedType>(magnitude * 10 + digit);
+        }
+        dst = negative ? static_cast<DstType>(UnsignedType(0) - magnitude) : static_cast<DstType>(magnitude);
+        return TLV_OK;
     }
 };
 
@@ -211,81 +702,290 @@ struct DigitalToStringTLVConverter : public BaseTLVConverter<TLVType, KeyName> {
 template<uint32_t tlvType, typename RuleTuple, const char* keyName = nullptr>
 struct SubStructTLVConverter : public BaseTLVConverter<tlvType, keyName> {
     using BaseTLVConverter<tlvType, keyName>::m_tlvType;
-    using BaseTLVConverter<tlvType, keyName>::m_keyName;
 
     RuleTuple m_ruleTuple;
     
     explicit SubStructTLVConverter(RuleTuple &ruleTuple) : m_ruleTuple(std::move(ruleTuple)) {}
     
-    template<typename SrcType>
-    void operator()(const SrcType& src, std::shared_ptr<TLVWriter>& dst) const 
+    // 子结构体直接写入父缓冲区：先写记录头并占位 length，字段写完后回填
+    template<typename SrcType, typename Sink>
+    void operator()(const SrcType& src, BasicTLVWriter<Sink>& dst) const 
     {
-        auto tempDst = std::make_shared<TLVWriter>(1024);
-        StructFieldsConvert(src, tempDst, m_ruleTuple);
-        
-        size_t len = tempDst->size();
-        if (len > 0) {
-            if (m_keyName == nullptr) {
-                dst->AppendBuf(m_tlvType, reinterpret_cast<const char*>(tempDst->data()), len);
-            } else {
-                dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, reinterpret_cast<const char*>(tempDst->data()), len);
-            }
+        size_t recordOffset = BaseTLVConverter<tlvType, keyName>::BeginRecord(dst);
+        size_t valueOffset = dst.size();
+        ConvertAllFields(src, dst, m_ruleTuple, std::make_index_sequence<RuleTuple::size>{});
+
+        // 子结构体内容为空时撤销已写入的记录头
+        if (dst.size() == valueOffset) {
+            dst.AbortRecord(recordOffset);
+        } else {
+            dst.EndRecord(recordOffset);
         }
     }
 
     // C 风格数组特化
-    template<typename SrcType, size_t N>
-    void operator()(const SrcType (&src)[N], std::shared_ptr<TLVWriter>& dst) const 
+    template<typename SrcType, size_t N, typename Sink>
+    void operator()(const SrcType (&src)[N], BasicTLVWriter<Sink>& dst) const 
     {
         for (size_t i = 0; i < N; ++i) {
-            auto tempDst = std::make_shared<TLVWriter>(1024);
-            StructFieldsConvert(src[i], tempDst, m_ruleTuple);
-            
-            size_t len = tempDst->size();
-            if (len > 0) {
-                if (m_keyName == nullptr) {
-                    dst->AppendBuf(m_tlvType, reinterpret_cast<const char*>(tempDst->data()), len);
-                } else {
-                    dst->AppendPair(m_tlvType, m_keyName, strlen(m_keyName) + 1, 
-                                   reinterpret_cast<const char*>(tempDst->data()), len);
-                }
-            }
+            (*this)(src[i], dst);
         }
     }
 
     // 可变长数组特化
-    template<typename T>
-    void operator()(const VariableLengthArray<T>& src, std::shared_ptr<TLVWriter>& dst) const 
+    template<typename T, typename Sink>
+    void operator()(const VariableLengthArray<T>& src, BasicTLVWriter<Sink>& dst) const 
     {
         // 逐个序列化数组元素
         for (uint32_t i = 0; i < src.length; ++i) {
-            auto tempDst = std::make_shared<TLVWriter>(1024);
-            StructFieldsConvert(src.data[i], tempDst, m_ruleTuple);
-
-            size_t len = tempDst->size();
-            if (len > 0) {
-                if (keyName == nullptr) {
-                    dst->AppendBuf(tlvType, reinterpret_cast<const char*>(tempDst->data()), len);
-                } else {
-                    dst->AppendPair(tlvType, keyName, strlen(keyName) + 1, 
-                                reinterpret_cast<const char*>(tempDst->data()), len);
-                }
-            }
+            (*this)(src.data[i], dst);
         }
-        
     }
+
+    // 子结构体内容为空时不输出记录，与 operator() 保持一致
+    template<typename SrcType>
+    size_t SerializedSize(const SrcType& src) const
+    {
+        size_t len = csrl::SerializedSize(src, m_ruleTuple);
+        return len == 0 ? 0 : TLV_HEADER_SIZE + BaseTLVConverter<tlvType, keyName>::KeySize() + len;
+    }
+
+    template<typename SrcType, size_t N>
+    size_t SerializedSize(const SrcType (&src)[N]) const
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < N; ++i) {
+            total += SerializedSize(src[i]);
+        }
+        return total;
+    }
+
+    template<typename T>
+    size_t SerializedSize(const VariableLengthArray<T>& src) const
+    {
+        size_t total = 0;
+        for (uint32_t i = 0; i < src.length; ++i) {
+            total += SerializedSize(src.data[i]);
+        }
+        return total;
+    }
+
+    // 预留容量使用的长度上限，按子规则的 SerializedSizeHint 计算，空的子结构体同样计入记录头
+    template<typename SrcType>
+    size_t SerializedSizeHint(const SrcType& src) const
+    {
+        return TLV_HEADER_SIZE + BaseTLVConverter<tlvType, keyName>::KeySize() + csrl::SerializedSizeHint(src, m_ruleTuple);
+    }
+
+    template<typename SrcType, size_t N>
+    size_t SerializedSizeHint(const SrcType (&src)[N]) const
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < N; ++i) {
+            total += SerializedSizeHint(src[i]);
+        }
+        return total;
+    }
+
+    template<typename T>
+    size_t SerializedSizeHint(const VariableLengthArray<T>& src) const
+    {
+        size_t total = 0;
+        for (uint32_t i = 0; i < src.length; ++i) {
+            total += SerializedSizeHint(src.data[i]);
+        }
+        return total;
+    }
+
+    template<typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        using ElementType = typename std::remove_all_extents<SrcType>::type;
+        return FixedSubStructSize(csrl::FixedSerializedSize<ElementType, RuleTuple>(),
+                                  sizeof(SrcType) / sizeof(ElementType));
+    }
+
+    template<typename SrcType>
+    static constexpr bool ExactSerializedSize()
+    {
+        return csrl::ExactSerializedSize<typename std::remove_all_extents<SrcType>::type, RuleTuple>();
+    }
+
+    static constexpr size_t FixedSubStructSize(size_t len, size_t count)
+    {
+        return len == TLV_VARIABLE_SIZE || !BaseTLVConverter<tlvType, keyName>::ConstantKey::value ? TLV_VARIABLE_SIZE
+               : len == 0               ? 0
+                                        : count * (TLV_HEADER_SIZE + BaseTLVConverter<tlvType, keyName>::m_keySize + len);
+    }
+
+    // 反序列化：value 为子结构体各字段的 TLV 流，按子规则递归解析
+    template<typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t /*index*/) const
+    {
+        const uint8_t* value = nullptr;
+        size_t len = 0;
+        int32_t ret = BaseTLVConverter<tlvType, keyName>::SkipKey(record, value, len);
+        if (ret != TLV_OK) {
+            return ret;
+        }
+        return StructFieldsConvert(TLVReader(value, len), dst, m_ruleTuple);
+    }
+
+    // C 风格数组特化：第 index 条记录解析到第 index 个元素
+    template<typename DstType, size_t N>
+    int32_t Decode(const TLVRecord& record, DstType (&dst)[N], size_t index) const
+    {
+        if (index >= N) {
+            return TLV_ERR_INDEX_OUT_OF_RANGE;
+        }
+        return Decode(record, dst[index], index);
+    }
+};
+
+// 实现了 SerializedSize 的转换器默认给出精确长度，包含子规则的转换器通过 ExactSerializedSize 给出
+template<typename ConverterType, typename FieldType, typename = void>
+struct TLVConverterExactSize : std::true_type {};
+
+template<typename ConverterType, typename FieldType>
+struct TLVConverterExactSize<ConverterType, FieldType,
+                             void_t<decltype(ConverterType::template ExactSerializedSize<FieldType>())>>
+    : std::integral_constant<bool, ConverterType::template ExactSerializedSize<FieldType>()> {};
+
+// 转换器的序列化长度；未实现 SerializedSize 的自定义转换器按 0 计算，此时结果仅作为预留容量的下界
+template<typename ConverterType, typename FieldType, typename = void>
+struct TLVConverterSize {
+    static constexpr size_t m_fixedSize = TLV_VARIABLE_SIZE;
+    static constexpr bool m_exactSize = false;
+
+    static size_t Get(const ConverterType& /*converter*/, FieldType& /*field*/) { return 0; }
+};
+
+template<typename ConverterType, typename FieldType>
+struct TLVConverterSize<ConverterType, FieldType,
+                        void_t<decltype(std::declval<const ConverterType&>().SerializedSize(std::declval<FieldType&>()))>> {
+    static constexpr size_t m_fixedSize = ConverterType::template FixedSerializedSize<remove_cvref_t<FieldType>>();
+    static constexpr bool m_exactSize = TLVConverterExactSize<ConverterType, remove_cvref_t<FieldType>>::value;
+
+    static size_t Get(const ConverterType& converter, FieldType& field) { return converter.SerializedSize(field); }
+};
+
+// 转换器用于预留容量的长度上限；未实现 SerializedSizeHint 时与 SerializedSize 相同
+template<typename ConverterType, typename FieldType, typename = void>
+struct TLVConverterSizeHint {
+    static size_t Get(const ConverterType& converter, FieldType& field)
+    {
+        return TLVConverterSize<ConverterType, FieldType>::Get(converter, field);
+    }
+};
+
+template<typename ConverterType, typename FieldType>
+struct TLVConverterSizeHint<ConverterType, FieldType,
+                            void_t<decltype(std::declval<const ConverterType&>().SerializedSizeHint(std::declval<FieldType&>()))>> {
+    static size_t Get(const ConverterType& converter, FieldType& field) { return converter.SerializedSizeHint(field); }
 };
 
+// 检测以 std::shared_ptr<BasicTLVWriter<Sink>>& 为参数的旧式自定义转换器
+template<typename ConverterType, typename FieldType, typename Sink, typename = void>
+struct TLVConverterTakesSharedWriter : std::false_type {};
+
+template<typename ConverterType, typename FieldType, typename Sink>
+struct TLVConverterTakesSharedWriter<ConverterType, FieldType, Sink,
+    void_t<decltype(std::declval<const ConverterType&>()(std::declval<FieldType&>(),
+                                                          std::declval<std::shared_ptr<BasicTLVWriter<Sink>>&>()))>>
+    : std::true_type {};
+
+// 转换器是否直接接受 BasicTLVWriter<Sink>&
+// 通过静态成员 m_takesWriter 声明的转换器（内置转换器与 TLVWriterConverter）不需要检测 operator()；
+// 其余转换器先检测旧式的 shared_ptr 参数，不接受时按引用调用。检测返回类型需要推导的泛型 lambda 会实例化其函数体，
+// 只检测 shared_ptr 参数才能保证 [](const auto& v, auto& w) { w->Append(...); } 这类旧式转换器仍可编译
+template<typename ConverterType, typename FieldType, typename Sink, typename = void>
+struct TLVConverterTakesWriter
+    : std::integral_constant<bool, !TLVConverterTakesSharedWriter<ConverterType, FieldType, Sink>::value> {};
+
+template<typename ConverterType, typename FieldType, typename Sink>
+struct TLVConverterTakesWriter<ConverterType, FieldType, Sink, void_t<decltype(ConverterType::m_takesWriter)>>
+    : std::integral_constant<bool, ConverterType::m_takesWriter> {};
+
+// 以 BasicTLVWriter<Sink>& 为参数的泛型 lambda 无法声明 m_takesWriter，通过 MakeTLVWriterConverter 包装后使用
+template<typename Func>
+struct TLVWriterConverter {
+    static constexpr bool m_takesWriter = true;
+    Func m_func;
+
+    template<typename FieldType, typename Sink>
+    void operator()(FieldType& field, BasicTLVWriter<Sink>& dst) const
+    {
+        m_func(field, dst);
+    }
+};
+
+template<typename Func>
+TLVWriterConverter<std::decay_t<Func>> MakeTLVWriterConverter(Func&& func)
+{
+    return TLVWriterConverter<std::decay_t<Func>>{std::forward<Func>(func)};
+}
+
 template<typename SrcPath, typename ConverterType>
 struct FieldMappingTLVCustomRule {
     ConverterType m_converter;
 
     explicit FieldMappingTLVCustomRule(ConverterType f) : m_converter(std::move(f)) {}
 
+    template<typename SrcType, typename Sink>
+    void Convert(SrcType& src, BasicTLVWriter<Sink>& dst) const
+    {
+        using FieldType = std::remove_reference_t<decltype(GetFieldByPath(src, SrcPath{}))>;
+        Invoke(GetFieldByPath(src, SrcPath{}), dst, TLVConverterTakesWriter<ConverterType, FieldType, Sink>());
+    }
+
+    template<typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t index) const
+    {
+        return m_converter.Decode(record, GetFieldByPath(dst, SrcPath{}), index);
+    }
+
     template<typename SrcType>
-    void Convert(SrcType& src, std::shared_ptr<TLVWriter>& dst) const
+    size_t SerializedSize(SrcType& src) const
     {
-        m_converter(GetFieldByPath(src, SrcPath{}), dst);
+        using FieldType = std::remove_reference_t<decltype(GetFieldByPath(src, SrcPath{}))>;
+        return TLVConverterSize<ConverterType, FieldType>::Get(m_converter, GetFieldByPath(src, SrcPath{}));
+    }
+
+    template<typename SrcType>
+    size_t SerializedSizeHint(SrcType& src) const
+    {
+        using FieldType = std::remove_reference_t<decltype(GetFieldByPath(src, SrcPath{}))>;
+        return TLVConverterSizeHint<ConverterType, FieldType>::Get(m_converter, GetFieldByPath(src, SrcPath{}));
+    }
+
+    template<typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        using FieldType = std::remove_reference_t<decltype(GetFieldByPath(std::declval<SrcType&>(), SrcPath{}))>;
+        return TLVConverterSize<ConverterType, FieldType>::m_fixedSize;
+    }
+
+    template<typename SrcType>
+    static constexpr bool ExactSerializedSize()
+    {
+        using FieldType = std::remove_reference_t<decltype(GetFieldByPath(std::declval<SrcType&>(), SrcPath{}))>;
+        return TLVConverterSize<ConverterType, FieldType>::m_exactSize;
+    }
+
+private:
+    template<typename FieldType, typename Sink>
+    void Invoke(FieldType& field, BasicTLVWriter<Sink>& dst, std::true_type /*takesWriter*/) const
+    {
+        m_converter(field, dst);
+    }
+
+    // 兼容以 std::shared_ptr<BasicTLVWriter<Sink>>& 为参数的自定义转换器
+    // 通过别名构造得到不持有所有权的 shared_ptr，不分配控制块，也不修改引用计数
+    template<typename FieldType, typename Sink>
+    void Invoke(FieldType& field, BasicTLVWriter<Sink>& dst, std::false_type /*takesWriter*/) const
+    {
+        std::shared_ptr<BasicTLVWriter<Sink>> writer(std::shared_ptr<BasicTLVWriter<Sink>>(), &dst);
+        m_converter(field, writer);
     }
 };
 
@@ -295,17 +995,345 @@ auto MakeFieldMappingTLVCustomRule(FieldPath<SrcIndexs...>, ConverterType&& conv
     return FieldMappingTLVCustomRule<FieldPath<SrcIndexs...>, ConverterType>(std::forward<ConverterType>(converter));
 }
 
+template <typename SrcStruct, typename RuleTuple, std::size_t... I>
+size_t SumSerializedSize(const SrcStruct& src, const RuleTuple& mappingRuleTuple, std::index_sequence<I...>)
+{
+    size_t sizes[] = {0, mappingRuleTuple.template GetMapping<I>().SerializedSize(src)...};
+    size_t total = 0;
+    for (size_t size : sizes) {
+        total += size;
+    }
+    return total;
+}
+
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSize(const SrcStruct& src, const RuleTuple& mappingRuleTuple)
+{
+    return SumSerializedSize(src, mappingRuleTuple, std::make_index_sequence<RuleTuple::size>{});
+}
+
+template <typename SrcStruct, typename RuleTuple, std::size_t... I>
+size_t SumSerializedSizeHint(const SrcStruct& src, const RuleTuple& mappingRuleTuple, std::index_sequence<I...>)
+{
+    size_t sizes[] = {0, mappingRuleTuple.template GetMapping<I>().SerializedSizeHint(src)...};
+    size_t total = 0;
+    for (size_t size : sizes) {
+        total += size;
+    }
+    return total;
+}
+
+// 序列化长度的上限，只用于预留容量：与 SerializedSize 相同，但允许转换器返回无需格式化即可得到的上限
+template <typename SrcStruct, typename RuleTuple>
+size_t SerializedSizeHint(const SrcStruct& src, const RuleTuple& mappingRuleTuple)
+{
+    return SumSerializedSizeHint(src, mappingRuleTuple, std::make_index_sequence<RuleTuple::size>{});
+}
+
+constexpr size_t SumFixedSerializedSize(const size_t* sizes, size_t count)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (sizes[i] == TLV_VARIABLE_SIZE) {
+            return TLV_VARIABLE_SIZE;
+        }
+        total += sizes[i];
+    }
+    return total;
+}
+
+template <typename SrcStruct, typename RuleTuple, std::size_t... I>
+constexpr size_t SumFixedSerializedSize(std::index_sequence<I...>)
+{
+    const size_t sizes[] = {0, std::tuple_element_t<I, decltype(std::declval<RuleTuple>().mappings)>::template FixedSerializedSize<SrcStruct>()...};
+    return SumFixedSerializedSize(sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
+
+// 编译期计算定长结构体序列化后的总字节数，存在变长字段时返回 TLV_VARIABLE_SIZE
+template <typename SrcStruct, typename RuleTuple>
+constexpr size_t FixedSerializedSize()
+{
+    return SumFixedSerializedSize<SrcStruct, RuleTuple>(std::make_index_sequence<RuleTuple::size>{});
+}
+
+constexpr bool AllExactSerializedSize(const bool* exact, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        if (!exact[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename SrcStruct, typename RuleTuple, std::size_t... I>
+constexpr bool AllExactSerializedSize(std::index_sequence<I...>)
+{
+    const bool exact[] = {true, std::tuple_element_t<I, decltype(std::declval<RuleTuple>().mappings)>::template ExactSerializedSize<SrcStruct>()...};
+    return AllExactSerializedSize(exact, sizeof(exact) / sizeof(exact[0]));
+}
+
+// 编译期判断 SerializedSize 的结果是否精确：存在未实现 SerializedSize 的自定义转换器（包括子结构体中的）时只是下界
+template <typename SrcStruct, typename RuleTuple>
+constexpr bool ExactSerializedSize()
+{
+    return AllExactSerializedSize<SrcStruct, RuleTuple>(std::make_index_sequence<RuleTuple::size>{});
+}
+
+// 预留容量使用的序列化长度：定长结构体直接取编译期常量，只有存在变长字段时才在运行期遍历字段
+template <typename SrcStruct, typename RuleTuple>
+size_t ReserveSerializedSize(const SrcStruct& src, const RuleTuple& mappingRuleTuple)
+{
+    constexpr size_t fixedSize = FixedSerializedSize<remove_cvref_t<SrcStruct>, RuleTuple>();
+    return fixedSize != TLV_VARIABLE_SIZE ? fixedSize : SerializedSizeHint(src, mappingRuleTuple);
+}
+
+// 序列化到 TLVWriter：先按映射规则计算总字节数并一次性预留，避免逐条追加时反复扩容
+// 写入器以引用传入，可以位于栈上，转换器展开后直接操作写入器而不经过 shared_ptr 的间接访问
+template <typename SrcStruct, typename Sink, typename RuleTuple>
+void StructFieldsConvert(SrcStruct& src, BasicTLVWriter<Sink>& dst, const RuleTuple& mappingRuleTuple)
+{
+    dst.reserve(dst.size() + ReserveSerializedSize(src, mappingRuleTuple));
+    ConvertAllFields(src, dst, mappingRuleTuple, std::make_index_sequence<RuleTuple::size>{});
+}
+
+// 兼容以 std::shared_ptr 持有写入器的调用方
+template <typename SrcStruct, typename Sink, typename RuleTuple>
+void StructFieldsConvert(SrcStruct& src, std::shared_ptr<BasicTLVWriter<Sink>>& dst, const RuleTuple& mappingRuleTuple)
+{
+    StructFieldsConvert(src, *dst, mappingRuleTuple);
+}
+
 template<uint32_t tlvType, std::size_t LengthIndex, std::size_t ArrayIndex, const char* keyName = nullptr>
 struct ComposedVariableLengthArrayTLVConverter {
-    template<typename SrcType>
-    void operator()(SrcType& src, std::shared_ptr<TLVWriter>& dst) const {
+    static constexpr uint32_t m_tlvType = tlvType;
+    static constexpr bool m_takesWriter = true;
+
+    template<typename SrcType, typename Sink>
+    void operator()(SrcType& src, BasicTLVWriter<Sink>& dst) const {
         // 先提取可变长数组
         auto varArray = VariableLengthArrayExtractor<LengthIndex, ArrayIndex>{}(src);
         // 然后使用 BaseTLVConverter 进行序列化
         BaseTLVConverter<tlvType, keyName>{}(varArray, dst);
     }
+
+    template<typename SrcType>
+    size_t SerializedSize(SrcType& src) const
+    {
+        return BaseTLVConverter<tlvType, keyName>{}.SerializedSize(VariableLengthArrayExtractor<LengthIndex, ArrayIndex>{}(src));
+    }
+
+    template<typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        return TLV_VARIABLE_SIZE;
+    }
+
+    // 反序列化：每条记录对应一个数组元素，写入第 index 个元素后同步更新长度字段
+    template<typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t index) const
+    {
+        auto& length = PathAccessor<LengthIndex>::GetField(dst);
+        auto& array = PathAccessor<ArrayIndex>::GetField(dst);
+        if (index >= std::extent<remove_cvref_t<decltype(array)>>::value) {
+            return TLV_ERR_INDEX_OUT_OF_RANGE;
+        }
+        int32_t ret = BaseTLVConverter<tlvType, keyName>{}.Decode(record, array[index], index);
+        if (ret == TLV_OK) {
+            length = static_cast<remove_cvref_t<decltype(length)>>(index + 1);
+        }
+        return ret;
+    }
+};
+
+// 打包的可变长数组 TLV 转换器：整个数组只输出一条记录，value 为 [键名] + uint32_t 元素个数 + 连续的元素数据
+// 相比逐元素输出省去了每个元素的头部和键名，元素数据整块写入，ScatterGatherSink 下只记录引用
+template<uint32_t tlvType, std::size_t LengthIndex, std::size_t ArrayIndex, const char* keyName = nullptr>
+struct PackedVariableLengthArrayTLVConverter {
+    static constexpr uint32_t m_tlvType = tlvType;
+    static constexpr size_t m_keySize = BaseTLVConverter<tlvType, keyName>::m_keySize;
+    static constexpr bool m_takesWriter = true;
+
+    template<typename SrcType, typename Sink>
+    void operator()(SrcType& src, BasicTLVWriter<Sink>& dst) const
+    {
+        auto varArray = VariableLengthArrayExtractor<LengthIndex, ArrayIndex>{}(src);
+        Append(varArray, dst, typename BaseTLVConverter<tlvType, keyName>::ConstantKey());
+    }
+
+    template<typename SrcType>
+    size_t SerializedSize(SrcType& src) const
+    {
+        auto varArray = VariableLengthArrayExtractor<LengthIndex, ArrayIndex>{}(src);
+        return TLV_HEADER_SIZE + BaseTLVConverter<tlvType, keyName>::KeySize() + sizeof(uint32_t) +
+               varArray.length * sizeof(*varArray.data);
+    }
+
+    template<typename SrcType>
+    static constexpr size_t FixedSerializedSize()
+    {
+        return TLV_VARIABLE_SIZE;
+    }
+
+    // 零拷贝地获取记录中的数组视图
+    template<typename T>
+    static int32_t View(const TLVRecord& record, TLVArrayView<T>& view)
+    {
+        const uint8_t* value = nullptr;
+        size_t len = 0;
+        int32_t ret = BaseTLVConverter<tlvType, keyName>::SkipKey(record, value, len);
+        if (ret != TLV_OK) {
+            return ret;
+        }
+        return TLVArrayView<T>::Parse(value, len, view);
+    }
+
+    // 反序列化：一条记录包含整个数组，一次拷贝到目标数组并更新长度字段
+    template<typename DstType>
+    int32_t Decode(const TLVRecord& record, DstType& dst, size_t /*index*/) const
+    {
+        auto& length = PathAccessor<LengthIndex>::GetField(dst);
+        auto& array = PathAccessor<ArrayIndex>::GetField(dst);
+        using ArrayType = remove_cvref_t<decltype(array)>;
+        TLVArrayView<typename std::remove_extent<ArrayType>::type> view;
+        int32_t ret = View(record, view);
+        if (ret != TLV_OK) {
+            return ret;
+        }
+        if (view.size() > std::extent<ArrayType>::value) {
+            return TLV_ERR_INDEX_OUT_OF_RANGE;
+        }
+        if (!view.empty()) {
+            memcpy(array, view.data(), view.bytes());
+        }
+        length = static_cast<remove_cvref_t<decltype(length)>>(view.size());
+        return TLV_OK;
+    }
+
+private:
+    // 记录头、键名与元素个数一次写入，元素数据作为第二段
+    template<typename T, typename Sink>
+    static void Append(const VariableLengthArray<T>& varArray, BasicTLVWriter<Sink>& dst, std::true_type /*constantKey*/)
+    {
+        size_t dataLen = varArray.length * sizeof(T);
+        uint8_t header[BaseTLVConverter<tlvType, keyName>::m_headerSize + sizeof(uint32_t)];
+        BaseTLVConverter<tlvType, keyName>::EncodeHeader(header, sizeof(uint32_t) + dataLen);
+        memcpy(header + BaseTLVConverter<tlvType, keyName>::m_headerSize, &varArray.length, sizeof(uint32_t));
+        dst.AppendEncodedRef(header, sizeof(header), reinterpret_cast<const char*>(varArray.data), dataLen);
+    }
+
+    // 键名长度在运行期确定：先写记录头与键名，元素个数与元素数据写入后回填 length
+    template<typename T, typename Sink>
+    static void Append(const VariableLengthArray<T>& varArray, BasicTLVWriter<Sink>& dst, std::false_type /*constantKey*/)
+    {
+        size_t recordOffset = BaseTLVConverter<tlvType, keyName>::BeginRecord(dst);
+        dst.AppendEncodedRef(&varArray.length, sizeof(uint32_t), reinterpret_cast<const char*>(varArray.data),
+                             varArray.length * sizeof(T));
+        dst.EndRecord(recordOffset);
+    }
 };
 
+// 获取 TLV 映射规则对应的 TLV type，要求转换器提供 m_tlvType
+template<typename MappingRule>
+struct TLVRuleType;
+
+template<typename SrcPath, typename ConverterType>
+struct TLVRuleType<FieldMappingTLVCustomRule<SrcPath, ConverterType>>
+    : std::integral_constant<uint32_t, std::decay_t<ConverterType>::m_tlvType> {};
+
+// 编译期生成的 TLV type → 规则下标分发表，查找代价与规则数量无关
+// 优先使用完美哈希（type 对最小无冲突模数取模），找不到时退化为 2 倍容量的线性探测表
+template<uint32_t... tlvTypes>
+struct TLVTypeDispatchTable {
+    static constexpr size_t m_count = sizeof...(tlvTypes);
+    static constexpr uint32_t m_types[m_count + 1] = {tlvTypes..., 0};
+    static constexpr size_t m_perfectModulus = FindPerfectHashModulus<8 * m_count + 8>(m_types, m_count, true);
+    static constexpr bool m_perfect = (m_perfectModulus != 0);
+    static constexpr size_t m_modulus = m_perfect ? m_perfectModulus : 2 * m_count + 1;
+    static constexpr PerfectHashSlots<m_modulus> m_table = BuildPerfectHashSlots<m_modulus>(m_types, m_count, true);
+
+    // 返回 type 对应的规则下标，未找到时返回 m_count
+    static size_t Find(uint32_t type)
+    {
+        size_t pos = type % m_modulus;
+        for (size_t probe = 0; probe < m_modulus; ++probe) {
+            uint32_t slot = m_table.m_slots[pos];
+            if (slot == PERFECT_HASH_EMPTY_SLOT) {
+                return m_count;
+            }
+            if (m_types[slot] == type) {
+                return slot;
+            }
+            if (m_perfect) {
+                return m_count;
+            }
+            pos = (pos + 1) % m_modulus;
+        }
+        return m_count;
+    }
+};
+
+template<uint32_t... tlvTypes>
+constexpr uint32_t TLVTypeDispatchTable<tlvTypes...>::m_types[];
+
+template<uint32_t... tlvTypes>
+constexpr PerfectHashSlots<TLVTypeDispatchTable<tlvTypes...>::m_modulus> TLVTypeDispatchTable<tlvTypes...>::m_table;
+
+// 将运行期得到的规则下标分发到编译期的映射规则
+template<typename RuleTuple>
+struct TLVRuleDispatcher;
+
+template<typename... MappingRules>
+struct TLVRuleDispatcher<MappingRuleTuple<MappingRules...>> {
+    using RuleTupleType = MappingRuleTuple<MappingRules...>;
+    using TableType = TLVTypeDispatchTable<TLVRuleType<MappingRules>::value...>;
+
+    template<typename DstStruct, size_t I>
+    static int32_t DecodeRule(const RuleTupleType& ruleTuple, const TLVRecord& record, DstStruct& dst, size_t index)
+    {
+        return ruleTuple.template GetMapping<I>().Decode(record, dst, index);
+    }
+
+    template<typename DstStruct, size_t... I>
+    static int32_t Decode(size_t ruleIndex, const RuleTupleType& ruleTuple, const TLVRecord& record, DstStruct& dst,
+                          size_t index, std::index_sequence<I...>)
+    {
+        // 跳转表，末尾的空指针仅用于规则为空时保持数组合法
+        using DecodeFunc = int32_t (*)(const RuleTupleType&, const TLVRecord&, DstStruct&, size_t);
+        static constexpr DecodeFunc funcs[] = {&DecodeRule<DstStruct, I>..., nullptr};
+        return funcs[ruleIndex](ruleTuple, record, dst, index);
+    }
+};
+
+// 反向转换器：按记录顺序遍历 TLV 流，通过编译期分发表定位映射规则并写入目标结构体
+// 映射规则中不存在的 type 会被跳过；同一规则的第 n 条记录以 index = n 传给转换器，用于填充数组
+template <typename DstStruct, typename RuleTuple>
+int32_t StructFieldsConvert(const TLVReader& src, DstStruct& dst, const RuleTuple& mappingRuleTuple)
+{
+    using Dispatcher = TLVRuleDispatcher<RuleTuple>;
+    size_t counts[RuleTuple::size + 1] = {0};
+    TLVReader::Iterator it = src.begin();
+    for (; it != src.end(); ++it) {
+        const TLVRecord& record = *it;
+        size_t ruleIndex = Dispatcher::TableType::Find(record.type);
+        if (ruleIndex == RuleTuple::size) {
+            continue;
+        }
+        int32_t ret = Dispatcher::Decode(ruleIndex, mappingRuleTuple, record, dst, counts[ruleIndex]++,
+                                         std::make_index_sequence<RuleTuple::size>{});
+        if (ret != TLV_OK) {
+            return ret;
+        }
+    }
+    return it.Status();
+}
+
+template <typename DstStruct, typename RuleTuple>
+int32_t StructFieldsConvert(TLVReader& src, DstStruct& dst, const RuleTuple& mappingRuleTuple)
+{
+    return StructFieldsConvert(static_cast<const TLVReader&>(src), dst, mappingRuleTuple);
+}
+
 // 新增某种特定的 TLV 转换器在此处添加宏
 
 // 默认 TLV 转换器宏
@@ -335,4 +1363,12 @@ struct ComposedVariableLengthArrayTLVConverter {
 #define MAKE_TLV_VARIABLE_LENGTH_ARRAY_MAPPING(SrcPath, LengthIndex, ArrayIndex, TLVType) \
     MakeFieldMappingTLVCustomRule(SrcPath, ComposedVariableLengthArrayTLVConverter<TLVType, LengthIndex, ArrayIndex>{})
 
+// 打包的可变长数组 TLV 转换器宏
+#define MAKE_TLV_PACKED_ARRAY_MAPPING(SrcPath, LengthIndex, ArrayIndex, TLVType) \
+    MakeFieldMappingTLVCustomRule(SrcPath, PackedVariableLengthArrayTLVConverter<TLVType, LengthIndex, ArrayIndex>{})
+
+// 带键值的打包可变长数组 TLV 转换器宏
+#define MAKE_TLV_PACKED_ARRAY_MAPPING_WITH_KEY(SrcPath, LengthIndex, ArrayIndex, TLVType, KeyName) \
+    MakeFieldMappingTLVCustomRule(SrcPath, PackedVariableLengthArrayTLVConverter<TLVType, LengthIndex, ArrayIndex, KeyName>{})
+
 }
@@ -0,0 +1,184 @@
+/**
+ * @file tlv_writer_pool.h
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLVWriter 对象池，按容量分级缓存已清空的写入器，稳态下序列化不再分配内存
+ * @version 0.1
+ * @date 2025-09-13
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "tlv_writer.h"
+
+namespace csrl {
+
+// 最小容量等级为 256 字节，每级容量翻倍，最大等级为 16MB，超过最大等级的写入器不回收
+constexpr size_t TLV_POOL_MIN_CLASS_SHIFT = 8;
+constexpr size_t TLV_POOL_CLASS_COUNT = 17;
+constexpr size_t TLV_POOL_DEFAULT_RETAINED_BYTES = 64 * 1024 * 1024;
+
+class TLVWriterPool;
+
+// 从 TLVWriterPool 取出的写入器，析构或 Release 时清空并归还到所属的池
+// 必须在取出它的线程中归还，且不能晚于所属的池销毁
+class PooledTLVWriter {
+public:
+    PooledTLVWriter() = default;
+
+    PooledTLVWriter(PooledTLVWriter&& other) noexcept : m_pool(other.m_pool), m_writer(std::move(other.m_writer))
+    {
+        other.m_pool = nullptr;
+    }
+
+    PooledTLVWriter& operator=(PooledTLVWriter&& other) noexcept
+    {
+        if (this != &other) {
+            Release();
+            m_pool = other.m_pool;
+            m_writer = std::move(other.m_writer);
+            other.m_pool = nullptr;
+        }
+        return *this;
+    }
+
+    PooledTLVWriter(const PooledTLVWriter&) = delete;
+    PooledTLVWriter& operator=(const PooledTLVWriter&) = delete;
+
+    ~PooledTLVWriter() { Release(); }
+
+    TLVWriter& Get() const { return *m_writer; }
+
+    TLVWriter& operator*() const { return *m_writer; }
+    TLVWriter* operator->() const { return m_writer.get(); }
+    explicit operator bool() const { return m_writer != nullptr; }
+
+    void Release();
+
+private:
+    friend class TLVWriterPool;
+
+    PooledTLVWriter(TLVWriterPool* pool, std::unique_ptr<TLVWriter> writer) : m_pool(pool), m_writer(std::move(writer)) {}
+
+    TLVWriterPool* m_pool = nullptr;
+    std::unique_ptr<TLVWriter> m_writer;
+};
+
+// 写入器对象池：按容量等级分桶保存已清空的写入器，取出时返回容量不小于请求值的写入器
+// 命中时不发生任何内存分配；缓存的总容量超过上限时直接释放归还的写入器
+// 对象池本身不加锁，通过 ThreadLocal() 为每个线程使用独立的实例
+class TLVWriterPool {
+public:
+    explicit TLVWriterPool(size_t maxRetainedBytes = TLV_POOL_DEFAULT_RETAINED_BYTES) : m_maxRetainedBytes(maxRetainedBytes)
+    {
+    }
+
+    TLVWriterPool(const TLVWriterPool&) = delete;
+    TLVWriterPool& operator=(const TLVWriterPool&) = delete;
+
+    // 当前线程的对象池
+    static TLVWriterPool& ThreadLocal()
+    {
+        static thread_local TLVWriterPool pool;
+        return pool;
+    }
+
+    // 取出容量不小于 capacity 的空写入器，未命中时按所在等级的容量新建
+    PooledTLVWriter Acquire(size_t capacity = size_t(1) << TLV_POOL_MIN_CLASS_SHIFT)
+    {
+        size_t sizeClass = CeilClass(capacity);
+        for (size_t i = sizeClass; i < TLV_POOL_CLASS_COUNT; ++i) {
+            if (!m_buckets[i].empty()) {
+                std::unique_ptr<TLVWriter> writer = std::move(m_buckets[i].back());
+                m_buckets[i].pop_back();
+                m_retainedBytes -= writer->capacity();
+                ++m_hits;
+                return PooledTLVWriter(this, std::move(writer));
+            }
+        }
+        ++m_misses;
+        size_t classCapacity = sizeClass < TLV_POOL_CLASS_COUNT ? ClassCapacity(sizeClass) : capacity;
+        return PooledTLVWriter(this, std::unique_ptr<TLVWriter>(new TLVWriter(classCapacity)));
+    }
+
+    uint64_t Hits() const { return m_hits; }
+    uint64_t Misses() const { return m_misses; }
+
+    // 因超过缓存上限或容量过大而没有回收的写入器个数
+    uint64_t Drops() const { return m_drops; }
+
+    size_t RetainedBytes() const { return m_retainedBytes; }
+    size_t MaxRetainedBytes() const { return m_maxRetainedBytes; }
+
+    // 释放全部缓存的写入器
+    void Trim()
+    {
+        for (auto& bucket : m_buckets) {
+            bucket.clear();
+        }
+        m_retainedBytes = 0;
+    }
+
+private:
+    friend class PooledTLVWriter;
+
+    static size_t ClassCapacity(size_t sizeClass) { return size_t(1) << (sizeClass + TLV_POOL_MIN_CLASS_SHIFT); }
+
+    // 容量不小于 capacity 的最小等级，超过最大等级时返回 TLV_POOL_CLASS_COUNT
+    static size_t CeilClass(size_t capacity)
+    {
+        size_t sizeClass = 0;
+        while (sizeClass < TLV_POOL_CLASS_COUNT && ClassCapacity(sizeClass) < capacity) {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    // 容量不超过 capacity 的最大等级，保证该桶中的写入器满足按等级取出的请求
+    static size_t FloorClass(size_t capacity)
+    {
+        size_t sizeClass = 0;
+        while (sizeClass + 1 < TLV_POOL_CLASS_COUNT && ClassCapacity(sizeClass + 1) <= capacity) {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    void Recycle(std::unique_ptr<TLVWriter>& writer)
+    {
+        size_t capacity = writer->capacity();
+        if (capacity < ClassCapacity(0) ||
+            capacity >= 2 * ClassCapacity(TLV_POOL_CLASS_COUNT - 1) || m_retainedBytes + capacity > m_maxRetainedBytes) {
+            ++m_drops;
+            writer.reset();
+            return;
+        }
+        writer->clear();
+        m_buckets[FloorClass(capacity)].push_back(std::move(writer));
+        m_retainedBytes += capacity;
+    }
+
+    std::vector<std::unique_ptr<TLVWriter>> m_buckets[TLV_POOL_CLASS_COUNT];
+    size_t m_maxRetainedBytes;
+    size_t m_retainedBytes = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_drops = 0;
+};
+
+inline void PooledTLVWriter::Release()
+{
+    if (m_pool != nullptr && m_writer != nullptr) {
+        m_pool->Recycle(m_writer);
+    }
+    m_pool = nullptr;
+    m_writer.reset();
+}
+
+} // namespace csrl
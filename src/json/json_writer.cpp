@@ -11,6 +11,51 @@
 #include "json_writer.h"
 
 namespace csrl {
+JsonWriter::JsonWriter() noexcept : m_dynAlc(yyjson_alc_dyn_new())
+{
+    if (m_dynAlc != nullptr) {
+        m_doc = yyjson_mut_doc_new(m_dynAlc);
+    }
+}
+
+JsonWriter::JsonWriter(void* buffer, size_t size) noexcept
+{
+    if (yyjson_alc_pool_init(&m_poolAlc, buffer, size)) {
+        m_doc = yyjson_mut_doc_new(&m_poolAlc);
+    }
+}
+
+bool JsonWriter::Reset() noexcept
+{
+    m_currentObject = nullptr;
+    if (m_doc == nullptr) {
+        return false;
+    }
+    // 先拷贝分配器，文档释放后其内部的 alc 不再可用
+    yyjson_alc alc = m_doc->alc;
+    yyjson_mut_doc_free(m_doc);
+    m_doc = yyjson_mut_doc_new(&alc);
+    return m_doc != nullptr;
+}
+
+int32_t JsonWriter::Serialize(std::string& out, yyjson_write_flag flag) const noexcept
+{
+    out.clear();
+    if (m_doc == nullptr) {
+        return JSON_ERR_INVALID_VALUE;
+    }
+    const yyjson_alc* alc = &m_doc->alc;
+    yyjson_write_err err;
+    size_t len = 0;
+    char* json = yyjson_mut_write_opts(m_doc, flag, alc, &len, &err);
+    if (json == nullptr) {
+        return err.code == YYJSON_WRITE_ERROR_MEMORY_ALLOCATION ? JSON_ERR_OVERFLOW : JSON_ERR_INVALID_VALUE;
+    }
+    out.assign(json, len);
+    alc->free(alc->ctx, json);
+    return JSON_OK;
+}
+
 yyjson_mut_val* JsonWriter::SetArrayAsRoot(const size_t) noexcept 
 {
     yyjson_mut_val* val = yyjson_mut_arr(m_doc);
@@ -8,6 +8,7 @@
 #include "field_convert.h"
 #include "field_operator.h"
 #include "tlv_writer.h"
+#include "tlv_reader.h"
 #include "json_writer.h"
 
 using CharArray = char[10];
@@ -57,7 +58,7 @@ void DemoVariableLengthArrayTLV()
     std::cout << "  weight = " << src.weight << "\n\n";
     
     // 创建TLV Writer
-    auto tlvWriter = std::make_shared<TLVWriter>(1024);
+    TLVWriter tlvWriter(1024);
     
     // 创建TLV映射规则
     auto tlvMappingRules = MakeMappingRuleTuple(
@@ -79,11 +80,11 @@ void DemoVariableLengthArrayTLV()
     
     // 输出序列化结果
     std::cout << "TLV序列化完成:\n";
-    std::cout << "  总大小: " << tlvWriter->size() << " 字节\n";
+    std::cout << "  总大小: " << tlvWriter.size() << " 字节\n";
     std::cout << "  数据内容: ";
     
-    const uint8_t* data = tlvWriter->data();
-    for (size_t i = 0; i < tlvWriter->size(); ++i) {
+    const uint8_t* data = tlvWriter.data();
+    for (size_t i = 0; i < tlvWriter.size(); ++i) {
         printf("%02X ", data[i]);
         if ((i + 1) % 16 == 0) std::cout << "\n              ";
     }
@@ -91,17 +92,14 @@ void DemoVariableLengthArrayTLV()
     
     // 分析TLV数据结构
     std::cout << "TLV数据分析:\n";
-    size_t offset = 0;
     int tlvCount = 0;
     
-    while (offset + 8 <= tlvWriter->size()) {
-        uint32_t type = *reinterpret_cast<const uint32_t*>(data + offset);
-        uint32_t length = *reinterpret_cast<const uint32_t*>(data + offset + 4);
-        
+    TLVReader tlvReader(data, tlvWriter.size());
+    for (const TLVRecord& record : tlvReader) {
         std::cout << "  TLV #" << ++tlvCount << ":\n";
-        std::cout << "    Type: 0x" << std::hex << type << std::dec;
+        std::cout << "    Type: 0x" << std::hex << record.type << std::dec;
         
-        switch (type) {
+        switch (record.type) {
             case TLV_TYPE_ID:
                 std::cout << " (ID)";
                 break;
@@ -115,27 +113,25 @@ void DemoVariableLengthArrayTLV()
                 std::cout << " (UNKNOWN)";
         }
         
-        std::cout << "\n    Length: " << length << " 字节\n";
+        std::cout << "\n    Length: " << record.length << " 字节\n";
         std::cout << "    Value: ";
         
-        if (type == TLV_TYPE_ID && length == 4) {
-            int value = *reinterpret_cast<const int*>(data + offset + 8);
-            std::cout << value << " (整数)";
-        } else if (type == TLV_TYPE_WEIGHT && length == 4) {
-            float value = *reinterpret_cast<const float*>(data + offset + 8);
-            std::cout << value << " (浮点数)";
-        } else if (type == TLV_TYPE_ARRAY_DATA && length == 4) {
-            int value = *reinterpret_cast<const int*>(data + offset + 8);
-            std::cout << value << " (数组元素)";
+        int intValue = 0;
+        float floatValue = 0;
+        if (record.type == TLV_TYPE_ID && record.ValueAs(intValue)) {
+            std::cout << intValue << " (整数)";
+        } else if (record.type == TLV_TYPE_WEIGHT && record.ValueAs(floatValue)) {
+            std::cout << floatValue << " (浮点数)";
+        } else if (record.type == TLV_TYPE_ARRAY_DATA && record.ValueAs(intValue)) {
+            std::cout << intValue << " (数组元素)";
         } else {
-            for (uint32_t i = 0; i < length && i < 16; ++i) {
-                printf("%02X ", data[offset + 8 + i]);
+            for (uint32_t i = 0; i < record.length && i < 16; ++i) {
+                printf("%02X ", record.value[i]);
             }
-            if (length > 16) std::cout << "...";
+            if (record.length > 16) std::cout << "...";
         }
         
         std::cout << "\n\n";
-        offset += 8 + length;
     }
 }
 
@@ -161,11 +157,12 @@ int main()
     // 新增：可变长数组TLV序列化演示
     DemoVariableLengthArrayTLV();
 
-    yyjson_mut_doc *doc = yyjson_mut_doc_new(NULL);
-    JsonWriter jsonWriter(doc);
+    // JsonWriter 拥有自己的文档，无需也不能手动释放
+    JsonWriter jsonWriter;
     jsonWriter.SetNullAsRoot();
-
-    yyjson_mut_doc_free(doc);
+    std::string json;
+    jsonWriter.Serialize(json);
+    std::cout << "JSON 序列化结果: " << json << std::endl;
 
     return 0;
 }
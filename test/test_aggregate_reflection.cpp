@@ -0,0 +1,103 @@
+/**
+ * @file test_aggregate_reflection.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 普通聚合类型编译期反射测试，需要以 -DENABLE_AGGREGATE_REFLECTION=ON（C++20）构建
+ * @version 0.1
+ * @date 2025-09-06 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "field_convert.h"
+#include "get_field_names.h"
+#include "json_reader.h"
+#include "json_text_writer.h"
+#include "json_writer.h"
+#include "tlv_reader.h"
+#include "tlv_writer.h"
+
+using namespace csrl;
+
+// 模拟已有协议头文件中的普通结构体，没有使用 DEFINE_STRUCT_WITH_TUPLE_INTERFACE
+struct PlainPoint {
+    int32_t x;
+    double y;
+};
+
+struct PlainMessage {
+    uint32_t id;
+    bool enabled;
+    std::string name;
+    PlainPoint origin;
+    std::vector<int32_t> samples;
+};
+
+DEFINE_TUPLE_INTERFACE_FOR_AGGREGATE(PlainPoint)
+DEFINE_TUPLE_INTERFACE_FOR_AGGREGATE(PlainMessage)
+
+// 测试元组接口与字段名均在编译期得到
+TEST(AggregateReflectionTest, TupleInterface) {
+    static_assert(FieldCount<PlainMessage>::value == 5, "PlainMessage should have 5 fields");
+    static_assert(std::is_same<std::tuple_element_t<3, PlainMessage>, PlainPoint>::value, "origin is PlainPoint");
+    static_assert(FieldNameGetter<PlainMessage, 2>::Length() == 4, "name has 4 characters");
+    static_assert(FieldNameGetter<PlainPoint, 1>::Literal()[0] == 'y', "second field of PlainPoint is y");
+    static_assert(HasFieldNameGetter<PlainMessage>::value, "plain aggregates expose FieldNameGetter");
+
+    PlainMessage message{7, true, "msg", {1, 2.5}, {1, 2, 3}};
+    csrl::Get<0>(message) = 8;
+    EXPECT_EQ(message.id, 8u);
+    EXPECT_EQ(csrl::Get<3>(message).y, 2.5);
+    EXPECT_STREQ((FieldNameGetter<PlainMessage, 4>::Get()), "samples");
+    EXPECT_STREQ((FieldNameGetter<PlainPoint, 0>::Get()), "x");
+}
+
+// 测试 JSON 写入与读取直接作用于普通结构体
+TEST(AggregateReflectionTest, Json) {
+    PlainMessage message{7, true, "msg", {1, 2.5}, {1, 2, 3}};
+    const char* expected = "{\"id\":7,\"enabled\":true,\"name\":\"msg\",\"origin\":{\"x\":1,\"y\":2.5},\"samples\":[1,2,3]}";
+
+    JsonTextWriter writer;
+    EXPECT_EQ(writer.Write(message), JSON_OK);
+    EXPECT_EQ(writer.str(), expected);
+
+    JsonWriter domWriter;
+    domWriter.ValueAsRoot(message);
+    std::string json;
+    EXPECT_EQ(domWriter.Serialize(json), JSON_OK);
+    EXPECT_EQ(json, expected);
+
+    PlainMessage decoded{};
+    EXPECT_EQ(FromJson(json.data(), json.size(), decoded), JSON_OK);
+    EXPECT_EQ(decoded.id, 7u);
+    EXPECT_EQ(decoded.name, "msg");
+    EXPECT_EQ(decoded.origin.y, 2.5);
+    EXPECT_EQ(decoded.samples, message.samples);
+}
+
+// 测试 TLV 映射规则按字段下标访问普通结构体
+TEST(AggregateReflectionTest, TLV) {
+    PlainMessage message{7, true, "msg", {1, 2.5}, {}};
+    auto pointRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x21),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x22)
+    );
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<3>(), 0x12, pointRules)
+    );
+    auto writer = std::make_shared<TLVWriter>(64);
+    StructFieldsConvert(message, writer, rules);
+    ASSERT_EQ(writer->size(), 2 * TLV_HEADER_SIZE + sizeof(uint32_t) + 2 * TLV_HEADER_SIZE + sizeof(int32_t) +
+                                  sizeof(double));
+
+    TLVReader reader(writer->data(), writer->size());
+    auto it = reader.begin();
+    uint32_t id = 0;
+    ASSERT_TRUE(it->ValueAs(id));
+    EXPECT_EQ(id, 7u);
+}
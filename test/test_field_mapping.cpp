@@ -4,6 +4,7 @@
 #include "field_convert.h"
 #include <string>
 #include <cstring>
+#include <vector>
 
 using namespace csrl;
 
@@ -15,6 +16,18 @@ DEFINE_STRUCT_WITH_TUPLE_INTERFACE(InnerStruct, (int, a), (float, b), (double, c
 DEFINE_STRUCT_WITH_TUPLE_INTERFACE(NestedSource, (InnerStruct, inner), (int, count))
 DEFINE_STRUCT_WITH_TUPLE_INTERFACE(NestedTarget, (InnerStruct, inner), (int, count))
 
+// 协议版本之间的映射：前 5 个字段类型相同且连续
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ProtocolV1, (uint32_t, id), (uint16_t, port), (uint16_t, flags), (int64_t, seq),
+    (double, value), (std::string, name))
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ProtocolV2, (uint32_t, id), (uint16_t, port), (uint16_t, flags), (int64_t, seq),
+    (double, value), (std::string, name), (int32_t, extra))
+
+// 字段类型相同但相对偏移不同
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(PackedSource, (char, tag), (char, a), (int16_t, b))
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(PaddedTarget, (int32_t, tag), (char, a), (int16_t, b))
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BatchPoint, (int32_t, x), (int32_t, y), (uint64_t, id))
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(BatchPointCopy, (int32_t, x), (int32_t, y), (uint64_t, id))
+
 using CharArray = char[32];
 DEFINE_STRUCT_WITH_TUPLE_INTERFACE(StringToCharTest, (std::string, name), (int, id))
 DEFINE_STRUCT_WITH_TUPLE_INTERFACE(CharToStringTest, (CharArray, name), (int, id))
@@ -294,4 +307,156 @@ TEST(StructFieldsConvertTest, NestedStructConversion) {
     EXPECT_FLOAT_EQ(dst.inner.b, 1.5f);
     EXPECT_DOUBLE_EQ(dst.inner.c, 2.5);
     EXPECT_EQ(dst.count, 50);
-}
\ No newline at end of file
+}
+
+// 测试连续同类型字段合并为 memcpy 的转换计划
+TEST(StructFieldsConvertTest, MemcpyRun) {
+    ProtocolV1 src{7, 8080, 0x3, 123456789LL, 2.5, "v1"};
+    ProtocolV2 dst{0, 0, 0, 0, 0.0, "", -1};
+
+    auto mappingTuple = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<3>(), MakeFieldPath<3>()),
+        MakeFieldMappingRule(MakeFieldPath<4>(), MakeFieldPath<4>()),
+        MakeFieldMappingRule(MakeFieldPath<5>(), MakeFieldPath<5>())
+    );
+    using Rules = decltype(mappingTuple);
+    static_assert(MemcpyRunLength<ProtocolV1, ProtocolV2, Rules, 0>::value == 5, "fields 0..4 form one run");
+    static_assert(MemcpyRunLength<ProtocolV1, ProtocolV2, Rules, 5>::value == 0, "std::string is not trivially copyable");
+
+    StructFieldsConvert(src, dst, mappingTuple);
+    EXPECT_EQ(dst.id, 7u);
+    EXPECT_EQ(dst.port, 8080);
+    EXPECT_EQ(dst.flags, 0x3);
+    EXPECT_EQ(dst.seq, 123456789LL);
+    EXPECT_DOUBLE_EQ(dst.value, 2.5);
+    EXPECT_EQ(dst.name, "v1");
+    EXPECT_EQ(dst.extra, -1);
+
+    // 源与目标为同一对象时拷贝范围重叠
+    auto selfRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<3>(), MakeFieldPath<3>()),
+        MakeFieldMappingRule(MakeFieldPath<4>(), MakeFieldPath<4>())
+    );
+    static_assert(MemcpyRunLength<ProtocolV1, ProtocolV1, decltype(selfRules), 0>::value == 5, "fields 0..4 form one run");
+    ProtocolV1 self = src;
+    StructFieldsConvert(self, self, selfRules);
+    EXPECT_EQ(self.id, 7u);
+    EXPECT_EQ(self.port, 8080);
+    EXPECT_EQ(self.flags, 0x3);
+    EXPECT_EQ(self.seq, 123456789LL);
+    EXPECT_DOUBLE_EQ(self.value, 2.5);
+
+    // 源字段下标不连续时不合并
+    auto swapped = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<1>())
+    );
+    static_assert(MemcpyRunLength<ProtocolV1, ProtocolV2, decltype(swapped), 0>::value == 1, "indices must advance together");
+    StructFieldsConvert(src, dst, swapped);
+    EXPECT_EQ(dst.port, 0x3);
+    EXPECT_EQ(dst.flags, 8080);
+
+    // 相对偏移不同时退回逐字段转换
+    PackedSource packed{'t', 'a', 300};
+    PaddedTarget padded{0, 0, 0};
+    auto paddedRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>())
+    );
+    static_assert(MemcpyRunLength<PackedSource, PaddedTarget, decltype(paddedRules), 0>::value == 2, "same types");
+    StructFieldsConvert(packed, padded, paddedRules);
+    EXPECT_EQ(padded.tag, 0);
+    EXPECT_EQ(padded.a, 'a');
+    EXPECT_EQ(padded.b, 300);
+}
+
+// 测试批量转换：单线程与多线程的结果均与逐个转换一致
+TEST(StructFieldsConvertTest, Batch) {
+    std::vector<ProtocolV1> src(3 * BATCH_MIN_ELEMENTS_PER_THREAD + 5);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = ProtocolV1{static_cast<uint32_t>(i), static_cast<uint16_t>(i % 65536), 1, static_cast<int64_t>(i) * 3,
+                            i * 0.5, std::to_string(i)};
+    }
+    auto mappingTuple = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<6>()),  // uint32_t -> int32_t
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>()),
+        MakeFieldMappingRule(MakeFieldPath<3>(), MakeFieldPath<3>()),
+        MakeFieldMappingRule(MakeFieldPath<4>(), MakeFieldPath<4>()),
+        MakeFieldMappingRule(MakeFieldPath<5>(), MakeFieldPath<5>())
+    );
+
+    std::vector<ProtocolV2> expected(src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        StructFieldsConvert(src[i], expected[i], mappingTuple);
+    }
+
+    for (size_t threadCount : {1, 4}) {
+        std::vector<ProtocolV2> dst;
+        StructFieldsConvertBatch(src, dst, mappingTuple, threadCount);
+        ASSERT_EQ(dst.size(), src.size());
+        for (size_t i = 0; i < dst.size(); ++i) {
+            ASSERT_EQ(dst[i].extra, expected[i].extra) << i;
+            ASSERT_EQ(dst[i].port, expected[i].port) << i;
+            ASSERT_EQ(dst[i].seq, expected[i].seq) << i;
+            ASSERT_DOUBLE_EQ(dst[i].value, expected[i].value) << i;
+            ASSERT_EQ(dst[i].name, expected[i].name) << i;
+        }
+    }
+}
+
+// 测试批量转换的分块遍历：整体按位拷贝、布局不同时的逐字段回退，元素个数不是分块大小的整数倍
+TEST(StructFieldsConvertTest, BatchTiles) {
+    const size_t count = 2 * BATCH_TILE_ELEMENTS + 7;
+    std::vector<BatchPoint> points(count);
+    std::vector<PackedSource> packed(count);
+    for (size_t i = 0; i < count; ++i) {
+        points[i] = BatchPoint{static_cast<int32_t>(i), -static_cast<int32_t>(i), i * 7};
+        packed[i] = PackedSource{'t', static_cast<char>('a' + i % 26), static_cast<int16_t>(i)};
+    }
+
+    auto pointRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<0>(), MakeFieldPath<0>()),
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>())
+    );
+    static_assert(MemcpyRunLength<BatchPoint, BatchPointCopy, decltype(pointRules), 0>::value == 3, "whole struct");
+    std::vector<BatchPointCopy> copies(count, BatchPointCopy{0, 0, 0});
+    StructFieldsConvertBatch(points.data(), copies.data(), count, pointRules);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(copies[i].x, points[i].x) << i;
+        ASSERT_EQ(copies[i].y, points[i].y) << i;
+        ASSERT_EQ(copies[i].id, points[i].id) << i;
+    }
+
+    // 只拷贝后两个字段，第一个字段保持不变
+    auto tailRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>())
+    );
+    std::vector<BatchPointCopy> tails(count, BatchPointCopy{-1, 0, 0});
+    StructFieldsConvertBatch(points.data(), tails.data(), count, tailRules);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(tails[i].x, -1) << i;
+        ASSERT_EQ(tails[i].y, points[i].y) << i;
+        ASSERT_EQ(tails[i].id, points[i].id) << i;
+    }
+
+    auto paddedRules = MakeMappingRuleTuple(
+        MakeFieldMappingRule(MakeFieldPath<1>(), MakeFieldPath<1>()),
+        MakeFieldMappingRule(MakeFieldPath<2>(), MakeFieldPath<2>())
+    );
+    std::vector<PaddedTarget> padded(count, PaddedTarget{0, 0, 0});
+    StructFieldsConvertBatch(packed.data(), padded.data(), count, paddedRules);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(padded[i].tag, 0) << i;
+        ASSERT_EQ(padded[i].a, packed[i].a) << i;
+        ASSERT_EQ(padded[i].b, packed[i].b) << i;
+    }
+}
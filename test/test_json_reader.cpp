@@ -0,0 +1,133 @@
+/**
+ * @file test_json_reader.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief JSON 读取器测试
+ * @version 0.1
+ * @date 2025-08-16 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "define_tuple_interface.h"
+#include "json_reader.h"
+#include "json_writer.h"
+
+using namespace csrl;
+
+using CharArray4 = char[4];
+using Int16Array3 = int16_t[3];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonReaderPoint,
+    (int32_t, x),
+    (double, y)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonReaderRecord,
+    (uint8_t, id),
+    (bool, enabled),
+    (CharArray4, tag),
+    (std::string, name),
+    (Int16Array3, values),
+    (JsonReaderPoint, origin),
+    (std::vector<JsonReaderPoint>, points),
+    (float, ratio)
+);
+
+using Int32StdArray3 = std::array<int32_t, 3>;
+using PointMap = std::map<std::string, JsonReaderPoint>;
+using CountMap = std::unordered_map<std::string, int32_t>;
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonReaderContainers,
+    (Int32StdArray3, array),
+    (PointMap, points),
+    (CountMap, counts),
+    (std::vector<bool>, flags)
+);
+
+// 测试 ToJson 输出的往返、未知键忽略、字符数组截断以及整数转浮点
+TEST(JsonReaderTest, FromJson_RoundTrip) {
+    JsonReaderRecord src{200, true, "abc", "name", {1, -2, 3}, {-1, 0.5}, {{2, 1.5}, {3, 2.5}}, 0.25f};
+    yyjson_mut_doc* doc = ToJson(src);
+    ASSERT_NE(doc, nullptr);
+    size_t len = 0;
+    char* json = yyjson_mut_write(doc, 0, &len);
+    yyjson_mut_doc_free(doc);
+
+    JsonReaderRecord dst{};
+    EXPECT_EQ(FromJson(json, len, dst), JSON_OK);
+    free(json);
+    EXPECT_EQ(dst.id, src.id);
+    EXPECT_EQ(dst.enabled, src.enabled);
+    EXPECT_STREQ(dst.tag, src.tag);
+    EXPECT_EQ(dst.name, src.name);
+    EXPECT_EQ(memcmp(dst.values, src.values, sizeof(src.values)), 0);
+    EXPECT_EQ(dst.origin.x, src.origin.x);
+    EXPECT_DOUBLE_EQ(dst.origin.y, src.origin.y);
+    ASSERT_EQ(dst.points.size(), 2u);
+    EXPECT_EQ(dst.points[1].x, 3);
+    EXPECT_FLOAT_EQ(dst.ratio, src.ratio);
+
+    const char text[] = R"({"unknown":[1,{"x":2}],"tag":"truncated","ratio":2,"origin":{"y":4}})";
+    EXPECT_EQ(FromJson(text, strlen(text), dst), JSON_OK);
+    EXPECT_STREQ(dst.tag, "tru");
+    EXPECT_FLOAT_EQ(dst.ratio, 2.0f);
+    EXPECT_EQ(dst.origin.x, src.origin.x);
+    EXPECT_DOUBLE_EQ(dst.origin.y, 4.0);
+}
+
+// 测试非法 JSON、类型不匹配与越界
+TEST(JsonReaderTest, FromJson_Errors) {
+    JsonReaderRecord dst{};
+    const char* cases[] = {R"({"id":1)", R"({"id":"1"})", R"({"id":256})", R"({"id":-1})", R"({"values":[1,2,3,4]})",
+                           R"({"values":[1,70000]})", R"({"origin":[1]})", R"([1])"};
+    int32_t expected[] = {JSON_ERR_PARSE, JSON_ERR_TYPE_MISMATCH, JSON_ERR_OUT_OF_RANGE, JSON_ERR_OUT_OF_RANGE,
+                          JSON_ERR_OUT_OF_RANGE, JSON_ERR_OUT_OF_RANGE, JSON_ERR_TYPE_MISMATCH, JSON_ERR_TYPE_MISMATCH};
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        EXPECT_EQ(FromJson(cases[i], strlen(cases[i]), dst), expected[i]) << cases[i];
+    }
+
+    // 字段名表：按哈希定位后仍需比较字段名
+    using TableType = FieldNames<JsonReaderRecord>;
+    EXPECT_EQ(TableType::Find("points", 6), 6u);
+    EXPECT_EQ(TableType::Find("point", 5), TableType::m_count);
+    EXPECT_EQ(TableType::Find("", 0), TableType::m_count);
+}
+
+// 测试标准容器的往返：std::array、以字符串为键的 map 以及 std::vector<bool>
+TEST(JsonReaderTest, FromJson_Containers) {
+    JsonReaderContainers src{{1, -2, 3}, {{"a", {1, 0.5}}, {"b", {2, 1.5}}}, {{"x", 7}, {"y", -8}}, {true, false, true}};
+    yyjson_mut_doc* doc = ToJson(src);
+    ASSERT_NE(doc, nullptr);
+    size_t len = 0;
+    char* json = yyjson_mut_write(doc, 0, &len);
+    yyjson_mut_doc_free(doc);
+
+    JsonReaderContainers dst{{}, {{"stale", {9, 9.0}}}, {}, {}};
+    EXPECT_EQ(FromJson(json, len, dst), JSON_OK);
+    free(json);
+    EXPECT_EQ(dst.array, src.array);
+    ASSERT_EQ(dst.points.size(), 2u);
+    EXPECT_EQ(dst.points["b"].x, 2);
+    EXPECT_DOUBLE_EQ(dst.points["b"].y, 1.5);
+    EXPECT_EQ(dst.counts, src.counts);
+    EXPECT_EQ(dst.flags, src.flags);
+
+    // 重复的键以最后一个为准，数组越界与类型不匹配
+    const char duplicate[] = R"({"counts":{"x":1,"x":2}})";
+    EXPECT_EQ(FromJson(duplicate, strlen(duplicate), dst), JSON_OK);
+    ASSERT_EQ(dst.counts.size(), 1u);
+    EXPECT_EQ(dst.counts["x"], 2);
+    const char* cases[] = {R"({"array":[1,2,3,4]})", R"({"points":[1]})", R"({"counts":{"x":"1"}})", R"({"flags":[1]})"};
+    int32_t expected[] = {JSON_ERR_OUT_OF_RANGE, JSON_ERR_TYPE_MISMATCH, JSON_ERR_TYPE_MISMATCH, JSON_ERR_TYPE_MISMATCH};
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        EXPECT_EQ(FromJson(cases[i], strlen(cases[i]), dst), expected[i]) << cases[i];
+    }
+}
@@ -0,0 +1,252 @@
+/**
+ * @file test_json_writer.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief JSON 写入器测试
+ * @version 0.1
+ * @date 2025-08-09 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "define_tuple_interface.h"
+#include "json_text_writer.h"
+#include "json_writer.h"
+
+using namespace csrl;
+
+using CharArray8 = char[8];
+using Int32Array3 = int32_t[3];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonPoint,
+    (int32_t, x),
+    (double, y)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonRecord,
+    (uint32_t, id),
+    (bool, enabled),
+    (CharArray8, tag),
+    (std::string, name),
+    (Int32Array3, values),
+    (JsonPoint, origin),
+    (std::vector<JsonPoint>, points)
+);
+
+using UInt16Array3 = std::array<uint16_t, 3>;
+using Int64Array2 = long long[2];
+using NamedPoints = std::map<std::string, JsonPoint>;
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(JsonContainers,
+    (UInt16Array3, ports),
+    (Int64Array2, offsets),
+    (std::vector<double>, ratios),
+    (std::vector<bool>, flags),
+    (NamedPoints, points)
+);
+
+static std::string WriteJson(yyjson_mut_doc* doc)
+{
+    size_t len = 0;
+    char* json = yyjson_mut_write(doc, 0, &len);
+    std::string result(json, len);
+    free(json);
+    return result;
+}
+
+// 测试结构体递归转换：基础类型、字符数组、std::string、C 数组、嵌套结构体与 std::vector
+TEST(JsonWriterTest, ToJson_Struct) {
+    JsonRecord record{7, true, "tag", "name", {1, -2, 3}, {1, 0.5}, {{2, 1.5}, {3, 2.5}}};
+    yyjson_mut_doc* doc = ToJson(record);
+    ASSERT_NE(doc, nullptr);
+    EXPECT_EQ(WriteJson(doc),
+              "{\"id\":7,\"enabled\":true,\"tag\":\"tag\",\"name\":\"name\",\"values\":[1,-2,3],"
+              "\"origin\":{\"x\":1,\"y\":0.5},\"points\":[{\"x\":2,\"y\":1.5},{\"x\":3,\"y\":2.5}]}");
+
+    // 键名直接引用字段名字面量，不发生拷贝
+    yyjson_mut_obj_iter iter = yyjson_mut_obj_iter_with(yyjson_mut_doc_get_root(doc));
+    yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter);
+    ASSERT_NE(key, nullptr);
+    EXPECT_EQ(yyjson_mut_get_str(key), (FieldNameGetter<JsonRecord, 0>::Get()));
+    yyjson_mut_doc_free(doc);
+
+    // 结构体也可以作为普通值添加到已有对象中
+    yyjson_mut_doc* outer = yyjson_mut_doc_new(nullptr);
+    {
+        JsonWriter writer(outer);
+        writer.SetObjectAsRoot(0);
+        writer.AddValueToCurrentObject("point", JsonPoint{4, 8.25});
+        EXPECT_EQ(WriteJson(outer), "{\"point\":{\"x\":4,\"y\":8.25}}");
+    }
+}
+
+// 测试内存池：Reset 后复用内存，定长缓冲区不足时返回 nullptr
+TEST(JsonWriterTest, JsonWriter_Arena) {
+    JsonWriter writer;
+    ASSERT_NE(writer.GetDoc(), nullptr);
+    for (int32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(writer.Reset());
+        writer.SetObjectAsRoot(0);
+        writer.AddValueToCurrentObject("point", JsonPoint{i, 0.5});
+        EXPECT_EQ(WriteJson(writer.GetDoc()), "{\"point\":{\"x\":" + std::to_string(i) + ",\"y\":0.5}}");
+    }
+
+    // yyjson 首个值内存块约为 4KB，2048 个整数需要的空间超出缓冲区
+    std::vector<char> buffer(16 * 1024);
+    JsonWriter poolWriter(buffer.data(), buffer.size());
+    ASSERT_NE(poolWriter.GetDoc(), nullptr);
+    poolWriter.SetArrayAsRoot(0);
+    yyjson_mut_val* root = poolWriter.GetCurrentObject();
+    yyjson_mut_val* last = nullptr;
+    ASSERT_NE(root, nullptr);
+    for (int32_t i = 0; i < 2048; ++i) {
+        last = poolWriter.AddValueToArray(i, root);
+    }
+    EXPECT_EQ(last, nullptr);
+
+    // Reset 后缓冲区内存归还，可以重新构建文档
+    ASSERT_TRUE(poolWriter.Reset());
+    poolWriter.SetObjectAsRoot(0);
+    poolWriter.AddValueToCurrentObject("x", 1);
+    EXPECT_EQ(WriteJson(poolWriter.GetDoc()), "{\"x\":1}");
+}
+
+// 测试所有权：移动后原对象不再持有文档，同一对象可以反复 Reset 与 Serialize
+TEST(JsonWriterTest, JsonWriter_MoveAndSerialize) {
+    JsonWriter writer;
+    writer.SetObjectAsRoot(0);
+    writer.AddValueToCurrentObject("x", 1);
+
+    JsonWriter moved(std::move(writer));
+    EXPECT_EQ(writer.GetDoc(), nullptr);
+    EXPECT_EQ(writer.GetCurrentObject(), nullptr);
+    std::string json;
+    EXPECT_EQ(writer.Serialize(json), JSON_ERR_INVALID_VALUE);
+    EXPECT_EQ(moved.Serialize(json), JSON_OK);
+    EXPECT_EQ(json, "{\"x\":1}");
+
+    // 外部传入的文档由 JsonWriter 接管并释放
+    writer = JsonWriter(yyjson_mut_doc_new(nullptr));
+    writer.SetArrayAsRoot(0);
+    writer.AddValueToArray(2, writer.GetCurrentObject());
+    EXPECT_EQ(writer.Serialize(json), JSON_OK);
+    EXPECT_EQ(json, "[2]");
+
+    for (int32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(moved.Reset());
+        moved.ValueAsRoot(JsonPoint{i, 1.5});
+        EXPECT_EQ(moved.Serialize(json), JSON_OK);
+        EXPECT_EQ(json, "{\"x\":" + std::to_string(i) + ",\"y\":1.5}");
+    }
+
+    // NaN 无法序列化
+    moved.ValueAsRoot(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(moved.Serialize(json), JSON_ERR_INVALID_VALUE);
+    EXPECT_TRUE(json.empty());
+}
+
+// 测试键的各种来源：只有字段名键直接引用静态存储期的字面量，其余键（包括临时的 StringLiteral）拷贝到文档中
+TEST(JsonWriterTest, JsonWriter_Keys) {
+    JsonWriter writer;
+    writer.SetObjectAsRoot(0);
+    std::string stringKey = "string";
+    char bufferKey[16] = "buffer";
+    const char* pointerKey = "pointer";
+    const char lengthKey[] = "length_ignored";
+    writer.AddValueToCurrentObject(stringKey, 1);
+    writer.AddValueToCurrentObject(bufferKey, 2);
+    writer.AddValueToCurrentObject(pointerKey, 3);
+    writer.AddValueToCurrentObject({lengthKey, 6}, 4);
+    writer.AddValueToCurrentObject("literal", 5);
+    writer.AddValueToCurrentObject(make_string_literal("temporary"), 6);
+    writer.AddValueToCurrentObject(JsonKey::FieldName<JsonPoint, 0>(), 7);
+
+    // 修改原始键不影响已拷贝的键
+    stringKey[0] = 'S';
+    bufferKey[0] = 'B';
+    std::string json;
+    EXPECT_EQ(writer.Serialize(json), JSON_OK);
+    EXPECT_EQ(json, "{\"string\":1,\"buffer\":2,\"pointer\":3,\"length\":4,\"literal\":5,\"temporary\":6,\"x\":7}");
+
+    yyjson_mut_obj_iter iter = yyjson_mut_obj_iter_with(writer.GetCurrentObject());
+    std::vector<const char*> keys;
+    yyjson_mut_val* key = nullptr;
+    while ((key = yyjson_mut_obj_iter_next(&iter)) != nullptr) {
+        keys.push_back(yyjson_mut_get_str(key));
+    }
+    ASSERT_EQ(keys.size(), 7u);
+    EXPECT_STREQ(keys[5], "temporary");
+    EXPECT_EQ(keys[6], (FieldNameGetter<JsonPoint, 0>::Get()));
+}
+
+// 测试容器：数值数组走批量接口，std::map 键按字符串输出，DOM 与流式写入结果一致
+TEST(JsonWriterTest, JsonWriter_Containers) {
+    static_assert(HasJsonBulkArray<uint16_t>::value && HasJsonBulkArray<double>::value, "numeric arrays use bulk API");
+    static_assert(!HasJsonBulkArray<JsonPoint>::value, "structs are converted one by one");
+    JsonContainers containers{{80, 443, 8080}, {-1, 1LL << 40}, {0.5, 2}, {true, false}, {{"a\"", {1, 1.5}}, {"b", {2, 2.5}}}};
+    const char* expected = "{\"ports\":[80,443,8080],\"offsets\":[-1,1099511627776],\"ratios\":[0.5,2.0],"
+                           "\"flags\":[true,false],\"points\":{\"a\\\"\":{\"x\":1,\"y\":1.5},\"b\":{\"x\":2,\"y\":2.5}}}";
+    yyjson_mut_doc* doc = ToJson(containers);
+    ASSERT_NE(doc, nullptr);
+    EXPECT_EQ(WriteJson(doc), expected);
+    yyjson_mut_doc_free(doc);
+
+    JsonTextWriter textWriter;
+    EXPECT_EQ(textWriter.Write(containers), JSON_OK);
+    EXPECT_EQ(textWriter.str(), expected);
+
+    // 可变长数组只输出有效元素，unordered_map 只有一个键时顺序确定
+    int32_t samples[8] = {5, 6, 7};
+    std::unordered_map<std::string, std::vector<int32_t>> series{{"s", {1, 2}}};
+    JsonWriter writer;
+    writer.SetObjectAsRoot(0);
+    writer.AddValueToCurrentObject("samples", MakeVariableLengthArray(3, samples));
+    writer.AddValueToCurrentObject("series", series);
+    std::string json;
+    EXPECT_EQ(writer.Serialize(json), JSON_OK);
+    EXPECT_EQ(json, "{\"samples\":[5,6,7],\"series\":{\"s\":[1,2]}}");
+
+    textWriter.clear();
+    EXPECT_EQ(textWriter.Write(MakeVariableLengthArray(3, samples)), JSON_OK);
+    EXPECT_EQ(textWriter.Write(series), JSON_OK);
+    EXPECT_EQ(textWriter.str(), "[5,6,7]{\"s\":[1,2]}");
+}
+
+// 测试流式写入：输出与 DOM 路径一致、字符串转义以及定长缓冲区溢出
+TEST(JsonWriterTest, JsonTextWriter_Struct) {
+    JsonRecord record{7, true, "t\"\n", "a\\b\x01", {1, -2, 3}, {1, 0.5}, {{2, 1.5}, {3, 2.5}}};
+    yyjson_mut_doc* doc = ToJson(record);
+    ASSERT_NE(doc, nullptr);
+
+    JsonTextWriter writer(16);
+    EXPECT_EQ(writer.Write(record), JSON_OK);
+    EXPECT_EQ(writer.str(), WriteJson(doc));
+    yyjson_mut_doc_free(doc);
+
+    // 空间不足时撤销本次写入的内容
+    char buffer[64];
+    JsonTextWriter fixedWriter(buffer, sizeof(buffer));
+    EXPECT_EQ(fixedWriter.Write(JsonPoint{4, 8.25}), JSON_OK);
+    EXPECT_STREQ(std::string(fixedWriter.data(), fixedWriter.size()).c_str(), "{\"x\":4,\"y\":8.25}");
+    size_t size = fixedWriter.size();
+    EXPECT_EQ(fixedWriter.Write(record), JSON_ERR_OVERFLOW);
+    EXPECT_EQ(fixedWriter.size(), size);
+
+    // 浮点数只需要实际位数的空间
+    char exactBuffer[16];
+    JsonTextWriter exactWriter(exactBuffer, sizeof(exactBuffer));
+    EXPECT_EQ(exactWriter.Write(JsonPoint{4, 8.25}), JSON_OK);
+    EXPECT_EQ(std::string(exactWriter.data(), exactWriter.size()), "{\"x\":4,\"y\":8.25}");
+
+    // NaN 无法用 JSON 表示
+    writer.clear();
+    EXPECT_EQ(writer.Write(JsonPoint{0, std::numeric_limits<double>::quiet_NaN()}), JSON_ERR_INVALID_VALUE);
+    EXPECT_EQ(writer.size(), 0u);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file test_tlv_parallel.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief 多线程批量 TLV 编码测试
+ * @version 0.1
+ * @date 2025-09-06 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "define_tuple_interface.h"
+#include "field_convert.h"
+#include "tlv_parallel.h"
+#include "tlv_writer.h"
+#include "tlv_writer_pool.h"
+
+using namespace csrl;
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ParallelRecord,
+    (uint32_t, id),
+    (int64_t, value),
+    (std::string, name)
+);
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ParallelEnvelope,
+    (uint32_t, seq),
+    (ParallelRecord, record)
+);
+
+// 未实现 SerializedSize 的自定义转换器，序列化长度只能得到下界
+struct UnsizedStringConverter {
+    template <typename Sink>
+    void operator()(const std::string& str, std::shared_ptr<BasicTLVWriter<Sink>>& dst) const
+    {
+        dst->AppendBuf(0x33, str.data(), str.size());
+    }
+};
+
+class TLVParallelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        records.resize(3 * TLV_PARALLEL_MIN_RECORDS + 7);
+        for (size_t i = 0; i < records.size(); ++i) {
+            records[i] = ParallelRecord{static_cast<uint32_t>(i), static_cast<int64_t>(i) * -7, std::to_string(i)};
+        }
+    }
+
+    // 顺序编码的结果作为期望值
+    template <typename RuleTuple>
+    std::vector<uint8_t> Sequential(const RuleTuple& rules)
+    {
+        auto writer = std::make_shared<TLVWriter>();
+        for (auto& record : records) {
+            StructFieldsConvert(record, writer, rules);
+        }
+        return std::vector<uint8_t>(writer->data(), writer->data() + writer->size());
+    }
+
+    std::vector<ParallelRecord> records;
+};
+
+// 编码长度在编译期确定时各线程直接编码到连续输出中属于自己的区间
+TEST_F(TLVParallelTest, Contiguous) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x31),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x32)
+    );
+    std::vector<uint8_t> expected = Sequential(rules);
+    static_assert(FixedSerializedSize<ParallelRecord, decltype(rules)>() == 2 * TLV_HEADER_SIZE + 12, "fixed layout");
+
+    for (size_t threadCount : {1, 4}) {
+        std::vector<uint8_t> out{0xAA};
+        EXPECT_EQ(StructFieldsConvertParallel(records.data(), records.size(), rules, out, threadCount), TLV_OK);
+        ASSERT_EQ(out.size(), expected.size() + 1);
+        EXPECT_EQ(out[0], 0xAA);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin() + 1));
+    }
+}
+
+// 长度不定时按上限预留：只有一个分块时直接编码到输出末尾再截断，多个分块时编码到对象池中的写入器后拼接
+TEST_F(TLVParallelTest, VariableSize) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x31),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<1>(), 0x32),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x33)
+    );
+    std::vector<uint8_t> expected = Sequential(rules);
+    static_assert(FixedSerializedSize<ParallelRecord, decltype(rules)>() == TLV_VARIABLE_SIZE, "variable layout");
+    static_assert(ExactSerializedSize<ParallelRecord, decltype(rules)>(), "built-in converters are sized exactly");
+
+    TLVWriterPool& pool = TLVWriterPool::ThreadLocal();
+    for (size_t threadCount : {1, 4}) {
+        uint64_t acquired = pool.Hits() + pool.Misses();
+        std::vector<uint8_t> out{0xAA};
+        EXPECT_EQ(StructFieldsConvertParallel(records.data(), records.size(), rules, out, threadCount), TLV_OK);
+        ASSERT_EQ(out.size(), expected.size() + 1);
+        EXPECT_EQ(out[0], 0xAA);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin() + 1));
+        if (threadCount == 1) {
+            EXPECT_EQ(pool.Hits() + pool.Misses(), acquired);
+        }
+    }
+
+    // 不足一个分块的最小元素个数时在调用线程中顺序编码
+    auto writer = std::make_shared<TLVWriter>();
+    for (size_t i = 0; i < 10; ++i) {
+        StructFieldsConvert(records[i], writer, rules);
+    }
+    std::vector<uint8_t> out;
+    EXPECT_EQ(StructFieldsConvertParallel(records.data(), 10, rules, out, 4), TLV_OK);
+    EXPECT_EQ(out, std::vector<uint8_t>(writer->data(), writer->data() + writer->size()));
+}
+
+// 分块输出：iovec 按顺序拼接与顺序编码一致；长度只是下界时连续输出改为分块编码后拼接
+TEST_F(TLVParallelTest, ChunkedAndFallback) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x31),
+        MakeFieldMappingTLVCustomRule(MakeFieldPath<2>(), UnsizedStringConverter{})
+    );
+    std::vector<uint8_t> expected = Sequential(rules);
+    static_assert(!ExactSerializedSize<ParallelRecord, decltype(rules)>(), "unsized converter gives a lower bound");
+    auto envelopeRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x30),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<1>(), 0x34, rules)
+    );
+    static_assert(!ExactSerializedSize<ParallelEnvelope, decltype(envelopeRules)>(), "nested rules are checked");
+
+    // 分块数不超过可同时运行的线程数
+    TLVChunkedOutput chunks;
+    EXPECT_EQ(StructFieldsConvertParallel(records.data(), records.size(), rules, chunks, 4), TLV_OK);
+    EXPECT_EQ(chunks.ChunkCount(), std::min<size_t>(3, HardwareThreadCount()));
+    EXPECT_EQ(chunks.size(), expected.size());
+
+    struct iovec iov[4];
+    ASSERT_EQ(chunks.GetIovecs(iov, 4), chunks.IovecCount());
+    std::vector<uint8_t> actual;
+    for (size_t i = 0; i < chunks.IovecCount(); ++i) {
+        const uint8_t* base = static_cast<const uint8_t*>(iov[i].iov_base);
+        actual.insert(actual.end(), base, base + iov[i].iov_len);
+    }
+    EXPECT_EQ(actual, expected);
+
+    // 拼接前的分块写入器取自调用线程的对象池，再次编码时复用
+    TLVWriterPool& pool = TLVWriterPool::ThreadLocal();
+    std::vector<uint8_t> out;
+    EXPECT_EQ(StructFieldsConvertParallel(records.data(), records.size(), rules, out, 4), TLV_OK);
+    EXPECT_EQ(out, expected);
+    uint64_t hits = pool.Hits();
+    out.clear();
+    EXPECT_EQ(StructFieldsConvertParallel(records.data(), records.size(), rules, out, 4), TLV_OK);
+    EXPECT_EQ(out, expected);
+    EXPECT_EQ(pool.Hits(), hits + chunks.ChunkCount());
+
+    // 重复使用时分块数可以减少
+    EXPECT_EQ(StructFieldsConvertParallel(records.data(), 10, rules, chunks, 4), TLV_OK);
+    EXPECT_EQ(chunks.ChunkCount(), 1u);
+}
@@ -0,0 +1,395 @@
+/**
+ * @file test_tlv_reader.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLV 读取器测试
+ * @version 0.1
+ * @date 2025-07-12 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include "tlv_writer.h"
+#include "tlv_reader.h"
+
+using namespace csrl;
+
+// 测试遍历 TLVWriter 输出的多条记录
+TEST(TLVReaderTest, Iterate_WriterOutput) {
+    TLVWriter writer(64);
+    int32_t intValue = 12345;
+    const char* text = "Hello";
+    writer.AppendBuf(0x1001, reinterpret_cast<const char*>(&intValue), sizeof(intValue));
+    writer.AppendPair(0x1002, "key", 4, text, strlen(text));
+    writer.AppendBuf(0x1003, nullptr, 0);
+
+    TLVReader reader(writer.data(), writer.size());
+    std::vector<TLVRecord> records(reader.begin(), reader.end());
+    EXPECT_EQ(reader.Status(), TLV_OK);
+    ASSERT_EQ(records.size(), 3u);
+
+    int32_t actualInt = 0;
+    EXPECT_EQ(records[0].type, 0x1001u);
+    EXPECT_TRUE(records[0].ValueAs(actualInt));
+    EXPECT_EQ(actualInt, intValue);
+
+    // value 直接指向原始缓冲区
+    EXPECT_EQ(records[1].type, 0x1002u);
+    EXPECT_EQ(records[1].length, 4 + strlen(text));
+    EXPECT_EQ(records[1].value, writer.data() + TLV_HEADER_SIZE + sizeof(intValue) + TLV_HEADER_SIZE);
+    EXPECT_STREQ(reinterpret_cast<const char*>(records[1].value), "key");
+    EXPECT_EQ(memcmp(records[1].value + 4, text, strlen(text)), 0);
+
+    // 长度不匹配时 ValueAs 失败
+    EXPECT_FALSE(records[1].ValueAs(actualInt));
+
+    EXPECT_EQ(records[2].type, 0x1003u);
+    EXPECT_EQ(records[2].length, 0u);
+}
+
+// 测试以记录的 value 构造嵌套读取器
+TEST(TLVReaderTest, Iterate_Nested) {
+    TLVWriter inner(64);
+    double doubleValue = 3.5;
+    inner.AppendBuf(0x2002, reinterpret_cast<const char*>(&doubleValue), sizeof(doubleValue));
+
+    TLVWriter outer(64);
+    outer.AppendBuf(0x2001, reinterpret_cast<const char*>(inner.data()), inner.size());
+
+    TLVReader reader(outer.data(), outer.size());
+    auto it = reader.begin();
+    ASSERT_NE(it, reader.end());
+    EXPECT_EQ(it->type, 0x2001u);
+
+    TLVReader nested(*it);
+    auto nestedIt = nested.begin();
+    ASSERT_NE(nestedIt, nested.end());
+    double actualDouble = 0;
+    EXPECT_TRUE(nestedIt->ValueAs(actualDouble));
+    EXPECT_DOUBLE_EQ(actualDouble, doubleValue);
+    EXPECT_EQ(++nestedIt, nested.end());
+    EXPECT_EQ(++it, reader.end());
+}
+
+// 测试越界数据的边界检查
+TEST(TLVReaderTest, Iterate_Truncated) {
+    TLVWriter writer(64);
+    int32_t intValue = 1;
+    writer.AppendBuf(0x3001, reinterpret_cast<const char*>(&intValue), sizeof(intValue));
+    writer.AppendBuf(0x3002, reinterpret_cast<const char*>(&intValue), sizeof(intValue));
+
+    // 第二条记录的 value 被截断
+    TLVReader truncatedValue(writer.data(), writer.size() - 1);
+    size_t count = 0;
+    for (const auto& record : truncatedValue) {
+        EXPECT_EQ(record.type, 0x3001u);
+        ++count;
+    }
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(truncatedValue.Status(), TLV_ERR_TRUNCATED_VALUE);
+
+    // 错误码保存在迭代器中，const 读取器可以被多次、同时遍历
+    const TLVReader& constReader = truncatedValue;
+    auto it = constReader.begin();
+    EXPECT_EQ(it.Status(), TLV_OK);
+    ++it;
+    EXPECT_EQ(it, constReader.end());
+    EXPECT_EQ(it.Status(), TLV_ERR_TRUNCATED_VALUE);
+    EXPECT_EQ(constReader.begin().Status(), TLV_OK);
+
+    // 头部被截断
+    TLVReader truncatedHeader(writer.data(), TLV_HEADER_SIZE - 1);
+    EXPECT_EQ(truncatedHeader.begin(), truncatedHeader.end());
+    EXPECT_EQ(truncatedHeader.Status(), TLV_ERR_TRUNCATED_HEADER);
+
+    // 空缓冲区
+    TLVReader empty(nullptr, 16);
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_EQ(empty.Status(), TLV_OK);
+}
+
+using CharArray8 = char[8];
+using Int32Array4 = int32_t[4];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ReaderSubStruct,
+    (int32_t, intField),
+    (double, doubleField)
+);
+
+using ReaderSubStructArray2 = ReaderSubStruct[2];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ReaderStruct,
+    (int32_t, id),
+    (CharArray8, name),
+    (int64_t, digital),
+    (ReaderSubStruct, sub),
+    (ReaderSubStructArray2, subArray),
+    (uint32_t, arrayLength),
+    (Int32Array4, dataArray)
+);
+
+static constexpr char READER_ID_KEY[] = "id";
+static constexpr char READER_SUB_KEY[] = "sub";
+
+// 测试同一组映射规则的序列化与反序列化往返
+TEST(TLVReverseMappingTest, RoundTrip) {
+    auto subRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x12)
+    );
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0x1001, READER_ID_KEY),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x1002),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<2>(), 0x1003),
+        MAKE_TLV_SUB_STRUCT_MAPPING_WITH_KEY(MakeFieldPath<3>(), 0x1004, subRules, READER_SUB_KEY),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<4>(), 0x1005, subRules),
+        MAKE_TLV_VARIABLE_LENGTH_ARRAY_MAPPING(MakeFieldPath<>(), 5, 6, 0x1006)
+    );
+
+    ReaderStruct src{7, "abc", -9876543210LL, {1, 1.5}, {{2, 2.5}, {3, 3.5}}, 3, {10, 20, 30, 0}};
+    auto writer = std::make_shared<TLVWriter>(256);
+    StructFieldsConvert(src, writer, rules);
+
+    ReaderStruct dst{};
+    TLVReader reader(writer->data(), writer->size());
+    EXPECT_EQ(StructFieldsConvert(reader, dst, rules), TLV_OK);
+
+    EXPECT_EQ(dst.id, src.id);
+    EXPECT_STREQ(dst.name, src.name);
+    EXPECT_EQ(dst.digital, src.digital);
+    EXPECT_EQ(dst.sub.intField, src.sub.intField);
+    EXPECT_DOUBLE_EQ(dst.sub.doubleField, src.sub.doubleField);
+    for (size_t i = 0; i < 2; ++i) {
+        EXPECT_EQ(dst.subArray[i].intField, src.subArray[i].intField);
+        EXPECT_DOUBLE_EQ(dst.subArray[i].doubleField, src.subArray[i].doubleField);
+    }
+    EXPECT_EQ(dst.arrayLength, src.arrayLength);
+    for (size_t i = 0; i < src.arrayLength; ++i) {
+        EXPECT_EQ(dst.dataArray[i], src.dataArray[i]);
+    }
+}
+
+// 测试未知 type 跳过、重复 type 的分发以及各类错误码
+TEST(TLVReverseMappingTest, DispatchAndErrors) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x2001),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<2>(), 0x3001),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<5>(), 0x2001)
+    );
+
+    TLVWriter writer(128);
+    int32_t id = 42;
+    writer.AppendBuf(0x9999, "skip", 4);
+    writer.AppendBuf(0x2001, reinterpret_cast<const char*>(&id), sizeof(id));
+    writer.AppendBuf(0x3001, "-12", 3);
+
+    ReaderStruct dst{};
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size()), dst, rules), TLV_OK);
+    EXPECT_EQ(dst.id, 42);
+    EXPECT_EQ(dst.digital, -12);
+    EXPECT_EQ(dst.arrayLength, 0u);
+
+    // 长度不匹配
+    writer.clear();
+    writer.AppendBuf(0x2001, "ab", 2);
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size()), dst, rules), TLV_ERR_LENGTH_MISMATCH);
+
+    // 非法数字字符串
+    writer.clear();
+    writer.AppendBuf(0x3001, "12a", 3);
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size()), dst, rules), TLV_ERR_INVALID_VALUE);
+
+    // 键名不一致
+    auto keyRules = MakeMappingRuleTuple(MAKE_TLV_DEFAULT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0x2001, READER_ID_KEY));
+    writer.clear();
+    writer.AppendPair(0x2001, "xx", 3, reinterpret_cast<const char*>(&id), sizeof(id));
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size()), dst, keyRules), TLV_ERR_KEY_MISMATCH);
+
+    // 数组记录数超过容量
+    auto arrayRules = MakeMappingRuleTuple(MAKE_TLV_VARIABLE_LENGTH_ARRAY_MAPPING(MakeFieldPath<>(), 5, 6, 0x1006));
+    writer.clear();
+    for (int i = 0; i < 5; ++i) {
+        writer.AppendBuf(0x1006, reinterpret_cast<const char*>(&id), sizeof(id));
+    }
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size()), dst, arrayRules), TLV_ERR_INDEX_OUT_OF_RANGE);
+    EXPECT_EQ(dst.arrayLength, 4u);
+
+    // 数据截断
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer.data(), writer.size() - 1), dst, rules), TLV_ERR_TRUNCATED_VALUE);
+}
+
+// 测试编译期分发表：连续 type 命中完美哈希，空规则与重复 type 的查找
+TEST(TLVReverseMappingTest, DispatchTable) {
+    using PerfectTable = TLVTypeDispatchTable<0x1001, 0x1002, 0x1003>;
+    static_assert(PerfectTable::m_perfect, "consecutive types should hash perfectly");
+    EXPECT_EQ(PerfectTable::Find(0x1002), 1u);
+    EXPECT_EQ(PerfectTable::Find(0x2002), 3u);
+
+    using EmptyTable = TLVTypeDispatchTable<>;
+    EXPECT_EQ(EmptyTable::Find(0x1001), 0u);
+
+    using DuplicateTable = TLVTypeDispatchTable<5, 5, 7>;
+    EXPECT_EQ(DuplicateTable::Find(5), 0u);
+    EXPECT_EQ(DuplicateTable::Find(7), 2u);
+}
+
+static constexpr char READER_ARRAY_KEY[] = "arr";
+
+// 测试打包数组：单条记录、零拷贝视图、往返以及容量检查
+TEST(TLVReverseMappingTest, PackedArray) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_PACKED_ARRAY_MAPPING_WITH_KEY(MakeFieldPath<>(), 5, 6, 0x1006, READER_ARRAY_KEY));
+
+    ReaderStruct src{};
+    src.arrayLength = 3;
+    src.dataArray[0] = 10;
+    src.dataArray[1] = -20;
+    src.dataArray[2] = 30;
+    auto writer = std::make_shared<TLVWriter>(64);
+    StructFieldsConvert(src, writer, rules);
+    ASSERT_EQ(writer->size(), TLV_HEADER_SIZE + sizeof(READER_ARRAY_KEY) + sizeof(uint32_t) + 3 * sizeof(int32_t));
+    EXPECT_EQ(writer->size(), SerializedSize(src, rules));
+
+    TLVReader reader(writer->data(), writer->size());
+    using PackedConverter = PackedVariableLengthArrayTLVConverter<0x1006, 5, 6, READER_ARRAY_KEY>;
+    TLVArrayView<int32_t> view;
+    ASSERT_EQ(PackedConverter::View(*reader.begin(), view), TLV_OK);
+    ASSERT_EQ(view.size(), 3u);
+    EXPECT_EQ(view.data(), writer->data() + TLV_HEADER_SIZE + sizeof(READER_ARRAY_KEY) + sizeof(uint32_t));
+    EXPECT_EQ(view[1], -20);
+
+    ReaderStruct dst{};
+    EXPECT_EQ(StructFieldsConvert(reader, dst, rules), TLV_OK);
+    EXPECT_EQ(dst.arrayLength, 3u);
+    EXPECT_EQ(memcmp(dst.dataArray, src.dataArray, 3 * sizeof(int32_t)), 0);
+
+    // 元素个数超过目标数组容量
+    int32_t oversized[5] = {};
+    uint32_t count = 5;
+    writer->clear();
+    char prefix[sizeof(READER_ARRAY_KEY) + sizeof(count)];
+    memcpy(prefix, READER_ARRAY_KEY, sizeof(READER_ARRAY_KEY));
+    memcpy(prefix + sizeof(READER_ARRAY_KEY), &count, sizeof(count));
+    writer->AppendPair(0x1006, prefix, sizeof(prefix), reinterpret_cast<const char*>(oversized), sizeof(oversized));
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer->data(), writer->size()), dst, rules), TLV_ERR_INDEX_OUT_OF_RANGE);
+
+    // 元素个数与长度不一致
+    writer->clear();
+    writer->AppendPair(0x1006, prefix, sizeof(prefix), reinterpret_cast<const char*>(oversized), sizeof(int32_t));
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer->data(), writer->size()), dst, rules), TLV_ERR_LENGTH_MISMATCH);
+}
+
+// 键名仅有声明、定义在其它位置（通常是另一个编译单元）时长度无法在编译期求得
+extern const char READER_EXTERN_ID_KEY[];
+extern const char READER_EXTERN_SUB_KEY[];
+extern const char READER_EXTERN_ARRAY_KEY[];
+
+// 测试非编译期常量键名：输出与编译期常量键名一致，且可以往返
+TEST(TLVReverseMappingTest, ExternKey) {
+    static_assert(!TLVConstantKey<READER_EXTERN_ID_KEY>::value, "extern key length is a runtime value");
+    static_assert(TLVConstantKey<READER_ID_KEY>::value, "constexpr key length is a compile-time value");
+    auto subRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x12)
+    );
+    auto externRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0x1001, READER_EXTERN_ID_KEY),
+        MAKE_TLV_SUB_STRUCT_MAPPING_WITH_KEY(MakeFieldPath<3>(), 0x1004, subRules, READER_EXTERN_SUB_KEY),
+        MAKE_TLV_PACKED_ARRAY_MAPPING_WITH_KEY(MakeFieldPath<>(), 5, 6, 0x1006, READER_EXTERN_ARRAY_KEY)
+    );
+    auto constantRules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0x1001, READER_ID_KEY),
+        MAKE_TLV_SUB_STRUCT_MAPPING_WITH_KEY(MakeFieldPath<3>(), 0x1004, subRules, READER_SUB_KEY),
+        MAKE_TLV_PACKED_ARRAY_MAPPING_WITH_KEY(MakeFieldPath<>(), 5, 6, 0x1006, READER_ARRAY_KEY)
+    );
+
+    ReaderStruct src{7, "abc", 0, {1, 1.5}, {}, 3, {10, -20, 30, 0}};
+    TLVWriter externWriter(0);
+    StructFieldsConvert(src, externWriter, externRules);
+    TLVWriter constantWriter(0);
+    StructFieldsConvert(src, constantWriter, constantRules);
+    ASSERT_EQ(externWriter.size(), constantWriter.size());
+    EXPECT_EQ(memcmp(externWriter.data(), constantWriter.data(), constantWriter.size()), 0);
+    EXPECT_EQ(SerializedSize(src, externRules), externWriter.size());
+
+    ReaderStruct dst{};
+    EXPECT_EQ(StructFieldsConvert(TLVReader(externWriter.data(), externWriter.size()), dst, externRules), TLV_OK);
+    EXPECT_EQ(dst.id, src.id);
+    EXPECT_EQ(dst.sub.intField, src.sub.intField);
+    EXPECT_DOUBLE_EQ(dst.sub.doubleField, src.sub.doubleField);
+    EXPECT_EQ(dst.arrayLength, src.arrayLength);
+    EXPECT_EQ(memcmp(dst.dataArray, src.dataArray, sizeof(src.dataArray)), 0);
+}
+
+const char READER_EXTERN_ID_KEY[] = "id";
+const char READER_EXTERN_SUB_KEY[] = "sub";
+const char READER_EXTERN_ARRAY_KEY[] = "arr";
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(ReaderNumberStruct,
+    (int64_t, minValue),
+    (uint64_t, maxValue),
+    (int8_t, smallValue),
+    (double, doubleValue),
+    (float, floatValue),
+    (bool, boolValue)
+);
+
+// 测试数字转字符串：整数边界值、浮点数最短往返格式以及反序列化
+TEST(TLVReverseMappingTest, DigitalString_Numbers) {
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<0>(), 0x4001),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<1>(), 0x4002),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<2>(), 0x4003),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<3>(), 0x4004),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<4>(), 0x4005),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<5>(), 0x4006)
+    );
+
+    // float 按自身精度输出最短格式，0.1f 不会输出为 double 的 0.10000000149011612
+    ReaderNumberStruct src{std::numeric_limits<int64_t>::min(), std::numeric_limits<uint64_t>::max(), -7, 0.1, 0.1f, true};
+    auto writer = std::make_shared<TLVWriter>(256);
+    StructFieldsConvert(src, writer, rules);
+    EXPECT_EQ(writer->size(), SerializedSize(src, rules));
+
+    std::vector<std::string> texts;
+    for (const auto& record : TLVReader(writer->data(), writer->size())) {
+        texts.emplace_back(reinterpret_cast<const char*>(record.value), record.length);
+    }
+    std::vector<std::string> expectedTexts = {"-9223372036854775808", "18446744073709551615", "-7", "0.1", "0.1", "1"};
+    EXPECT_EQ(texts, expectedTexts);
+
+    ReaderNumberStruct dst{};
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer->data(), writer->size()), dst, rules), TLV_OK);
+    EXPECT_EQ(dst.minValue, src.minValue);
+    EXPECT_EQ(dst.maxValue, src.maxValue);
+    EXPECT_EQ(dst.smallValue, src.smallValue);
+    EXPECT_EQ(dst.doubleValue, src.doubleValue);
+    EXPECT_EQ(dst.floatValue, src.floatValue);
+    EXPECT_EQ(dst.boolValue, src.boolValue);
+
+    // float 的最短格式：2 的幂处舍入区间不对称、次正规数、布局与 yyjson 输出 double 时一致
+    const std::pair<float, const char*> floatCases[] = {
+        {std::ldexp(1.0f, -96), "1.2621775e-29"}, {std::numeric_limits<float>::denorm_min(), "1e-45"},
+        {std::numeric_limits<float>::max(), "3.4028235e38"}, {-0.0f, "-0.0"}, {16777216.0f, "16777216.0"},
+        {1e21f, "1e21"}, {1.5e-6f, "0.0000015"}, {1e-7f, "1e-7"}};
+    for (const auto& floatCase : floatCases) {
+        char buf[NUMBER_BUFFER_SIZE];
+        size_t len = FormatShortest(floatCase.first, buf, YYJSON_WRITE_NOFLAG);
+        EXPECT_EQ(std::string(buf, len), floatCase.second);
+        EXPECT_EQ(strtof(std::string(buf, len).c_str(), nullptr), floatCase.first);
+    }
+
+    writer->clear();
+    writer->AppendBuf(0x4004, "1.5x", 4);
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer->data(), writer->size()), dst, rules), TLV_ERR_INVALID_VALUE);
+
+    writer->clear();
+    writer->AppendBuf(0x4006, "2", 1);
+    EXPECT_EQ(StructFieldsConvert(TLVReader(writer->data(), writer->size()), dst, rules), TLV_ERR_INVALID_VALUE);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_tlv_sink.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLV 写入器输出目标测试
+ * @version 0.1
+ * @date 2025-07-19 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "define_tuple_interface.h"
+#include "field_convert.h"
+#include "tlv_writer.h"
+
+using namespace csrl;
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(SinkSubStruct,
+    (int32_t, intField),
+    (double, doubleField)
+);
+
+using SinkSubStructArray4 = SinkSubStruct[4];
+using Int32Array64 = int32_t[64];
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(SinkStruct,
+    (uint32_t, id),
+    (SinkSubStructArray4, subArray),
+    (Int32Array64, samples)
+);
+
+class TLVSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int32_t i = 0; i < 64; ++i) {
+            src.samples[i] = i * i;
+        }
+        // 以默认的 VectorSink 输出作为期望结果
+        auto writer = std::make_shared<TLVWriter>(256);
+        Convert(writer);
+        expected.assign(writer->data(), writer->data() + writer->size());
+    }
+
+    template <typename Sink>
+    void Convert(std::shared_ptr<BasicTLVWriter<Sink>>& writer)
+    {
+        auto subRules = MakeMappingRuleTuple(
+            MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x21),
+            MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x22)
+        );
+        auto rules = MakeMappingRuleTuple(
+            MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x11),
+            MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<1>(), 0x12, subRules),
+            MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<2>(), 0x13)
+        );
+        StructFieldsConvert(src, writer, rules);
+    }
+
+    SinkStruct src{99, {{1, 1.5}, {2, 2.5}, {3, 3.5}, {4, 4.5}}, {}};
+    std::vector<uint8_t> expected;
+};
+
+// 测试定长缓冲区：空间足够时输出一致，空间不足时返回溢出错误并保留已完成的记录
+TEST_F(TLVSinkTest, FixedBufferSink) {
+    std::vector<uint8_t> buffer(expected.size());
+    auto writer = std::make_shared<BasicTLVWriter<FixedBufferSink>>(buffer.data(), buffer.size());
+    Convert(writer);
+    EXPECT_EQ(writer->status(), TLV_OK);
+    ASSERT_EQ(writer->size(), expected.size());
+    EXPECT_EQ(memcmp(writer->data(), expected.data(), expected.size()), 0);
+
+    // 只够容纳 id 记录、第一个子结构体以及第二个子结构体的一部分，未完成的嵌套记录被整体撤销
+    size_t subRecordSize = 3 * TLV_HEADER_SIZE + sizeof(int32_t) + sizeof(double);
+    size_t completeSize = TLV_HEADER_SIZE + sizeof(uint32_t) + subRecordSize;
+    auto smallWriter = std::make_shared<BasicTLVWriter<FixedBufferSink>>(buffer.data(), completeSize + subRecordSize - 1);
+    Convert(smallWriter);
+    EXPECT_EQ(smallWriter->status(), TLV_ERR_OVERFLOW);
+    EXPECT_EQ(smallWriter->size(), completeSize);
+
+    int32_t value = 1;
+    EXPECT_EQ(smallWriter->AppendBuf(0x11, reinterpret_cast<const char*>(&value), expected.size()), TLV_ERR_OVERFLOW);
+}
+
+// 测试分散缓冲区：记录跨越多个 iovec，回填 length 时同样跨段
+TEST_F(TLVSinkTest, IovecSink) {
+    uint8_t first[7];
+    uint8_t second[13];
+    std::vector<uint8_t> third(expected.size());
+    struct iovec iov[] = {{first, sizeof(first)}, {second, sizeof(second)}, {third.data(), third.size()}};
+
+    auto writer = std::make_shared<BasicTLVWriter<IovecSink>>(iov, 3);
+    Convert(writer);
+    EXPECT_EQ(writer->status(), TLV_OK);
+    EXPECT_EQ(writer->size(), expected.size());
+
+    struct iovec out[3];
+    ASSERT_EQ(writer->sink().GetIovecs(out, 3), 3u);
+    std::vector<uint8_t> actual;
+    for (const auto& vec : out) {
+        const uint8_t* base = static_cast<const uint8_t*>(vec.iov_base);
+        actual.insert(actual.end(), base, base + vec.iov_len);
+    }
+    EXPECT_EQ(actual, expected);
+}
+
+// 测试分散/聚集输出：大数组只记录引用，writev 输出与连续缓冲区一致
+TEST_F(TLVSinkTest, ScatterGatherSink) {
+    auto writer = std::make_shared<BasicTLVWriter<ScatterGatherSink>>(sizeof(src.samples));
+    Convert(writer);
+    EXPECT_EQ(writer->status(), TLV_OK);
+    EXPECT_EQ(writer->size(), expected.size());
+    EXPECT_EQ(writer->sink().InlineSize(), expected.size() - sizeof(src.samples));
+
+    // 内联的头部 + 引用的数组
+    struct iovec iov[2];
+    ASSERT_EQ(writer->sink().IovecCount(), 2u);
+    ASSERT_EQ(writer->sink().GetIovecs(iov, 2), 2u);
+    EXPECT_EQ(iov[1].iov_base, static_cast<void*>(src.samples));
+
+    FILE* file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(writev(fileno(file), iov, 2), static_cast<ssize_t>(expected.size()));
+    std::vector<uint8_t> actual(expected.size());
+    rewind(file);
+    EXPECT_EQ(fread(actual.data(), 1, actual.size(), file), expected.size());
+    EXPECT_EQ(actual, expected);
+    fclose(file);
+
+    // 撤销引用段之后的记录
+    writer->clear();
+    writer->AppendBufRef(0x13, reinterpret_cast<const char*>(src.samples), sizeof(src.samples));
+    size_t recordOffset = writer->BeginRecord(0x14);
+    writer->AppendBufRef(0x15, reinterpret_cast<const char*>(src.samples), sizeof(src.samples));
+    writer->AbortRecord(recordOffset);
+    EXPECT_EQ(writer->size(), TLV_HEADER_SIZE + sizeof(src.samples));
+    EXPECT_EQ(writer->sink().IovecCount(), 2u);
+}
+
+// 测试文件描述符：小块刷新、显式 Flush 写出剩余数据，以及 Clear 后重新写入
+TEST_F(TLVSinkTest, FdSink) {
+    FILE* file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    auto writer = std::make_shared<BasicTLVWriter<FdSink>>(fileno(file), 16);
+    Convert(writer);
+    EXPECT_EQ(writer->status(), TLV_OK);
+    EXPECT_EQ(writer->size(), expected.size());
+    EXPECT_EQ(writer->sink().Flush(), TLV_OK);
+
+    // 清空后大小与偏移从 0 开始，嵌套记录的 length 仍能正确回填
+    writer->clear();
+    EXPECT_EQ(writer->size(), 0u);
+    Convert(writer);
+    EXPECT_EQ(writer->status(), TLV_OK);
+    EXPECT_EQ(writer->size(), expected.size());
+    EXPECT_EQ(writer->sink().Flush(), TLV_OK);
+
+    std::vector<uint8_t> actual(2 * expected.size() + 1);
+    rewind(file);
+    EXPECT_EQ(fread(actual.data(), 1, actual.size(), file), 2 * expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin()));
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), actual.begin() + expected.size()));
+    fclose(file);
+
+    // 写入失败的文件描述符：提交失败由本次追加的返回值报告，而不是只记录在 status() 中
+    BasicTLVWriter<FdSink> badWriter(-1, 4);
+    int32_t value = 1;
+    EXPECT_EQ(badWriter.AppendBuf(0x11, reinterpret_cast<const char*>(&value), sizeof(value)), TLV_ERR_IO);
+    EXPECT_EQ(badWriter.status(), TLV_ERR_IO);
+    EXPECT_EQ(badWriter.sink().Flush(), TLV_ERR_IO);
+    badWriter.clear();
+}
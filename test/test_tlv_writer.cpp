@@ -11,6 +11,7 @@
 #include <gtest/gtest.h>
 #include <cstring>
 #include <memory>
+#include <string>
 #include "define_tuple_interface.h"
 #include "field_convert.h"
 #include "tlv_writer.h"
@@ -831,4 +832,181 @@ TEST_F(TLVWriterTest, SubStructTLVConverter_Array) {
         EXPECT_DOUBLE_EQ(actualDoubleValue, parentStructWithArray.subDataArray[i].doubleField);
         offset += sizeof(double);
     }
-}
\ No newline at end of file
+}
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(SerializedSizeStruct,
+    (int32_t, intValue),
+    (CharArray16, stringValue),
+    (int64_t, digitalValue),
+    (SubStructArray3, subDataArray)
+);
+
+// 记录运行期 SerializedSize 调用次数的定长转换器，编译期长度沿用 BaseTLVConverter
+static size_t g_serializedSizeCalls = 0;
+
+struct CountingSizeConverter : public BaseTLVConverter<0xA007> {
+    template<typename SrcType>
+    size_t SerializedSize(const SrcType& src) const
+    {
+        ++g_serializedSizeCalls;
+        return BaseTLVConverter<0xA007>::SerializedSize(src);
+    }
+};
+
+// 测试 SerializedSize 与实际输出一致：空写入器一次性预留精确容量，反复追加时按倍数扩容
+TEST_F(TLVWriterTest, SerializedSize_Reserve) {
+    auto subStructMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0xA002, INT_KEY_NAME),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0xA003)
+    );
+    auto fixedMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0xA001),
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<3>(), 0xA004, subStructMappingTuple)
+    );
+    auto variableMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0xA005),
+        MAKE_TLV_DIGITAL_STRING_MAPPING(MakeFieldPath<2>(), 0xA006)
+    );
+
+    // 定长结构体的序列化长度是编译期常量
+    constexpr size_t subSize = 2 * TLV_HEADER_SIZE + sizeof(INT_KEY_NAME) + sizeof(int32_t) + sizeof(double);
+    constexpr size_t fixedSize = FixedSerializedSize<SerializedSizeStruct, decltype(fixedMappingTuple)>();
+    static_assert(fixedSize == TLV_HEADER_SIZE + sizeof(int32_t) + 3 * (TLV_HEADER_SIZE + subSize), "fixed size");
+    static_assert(FixedSerializedSize<SerializedSizeStruct, decltype(variableMappingTuple)>() == TLV_VARIABLE_SIZE,
+                  "variable size");
+
+    SerializedSizeStruct src{7, "abc", -12345, {{1, 1.5}, {2, 2.5}, {3, 3.5}}};
+    EXPECT_EQ(SerializedSize(src, fixedMappingTuple), fixedSize);
+    EXPECT_EQ(SerializedSize(src, variableMappingTuple), 2 * TLV_HEADER_SIZE + 4 + 6);
+
+    auto sharedWriter = std::make_shared<TLVWriter>(0);
+    StructFieldsConvert(src, sharedWriter, fixedMappingTuple);
+    EXPECT_EQ(sharedWriter->size(), fixedSize);
+    EXPECT_EQ(sharedWriter->capacity(), fixedSize);
+
+    StructFieldsConvert(src, sharedWriter, variableMappingTuple);
+    EXPECT_EQ(sharedWriter->size(), fixedSize + SerializedSize(src, variableMappingTuple));
+    EXPECT_GE(sharedWriter->capacity(), sharedWriter->size());
+
+    // 反复追加时容量按倍数增长，不会每次追加都重新分配
+    size_t reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        size_t capacity = sharedWriter->capacity();
+        StructFieldsConvert(src, sharedWriter, fixedMappingTuple);
+        reallocations += sharedWriter->capacity() != capacity ? 1 : 0;
+    }
+    EXPECT_EQ(sharedWriter->size(), fixedSize * 1001 + SerializedSize(src, variableMappingTuple));
+    EXPECT_LE(reallocations, 12u);
+
+    // 定长布局直接使用编译期长度预留，不再在运行期遍历字段
+    auto countingMappingTuple = MakeMappingRuleTuple(MakeFieldMappingTLVCustomRule(MakeFieldPath<2>(), CountingSizeConverter{}));
+    TLVWriter countingWriter(0);
+    StructFieldsConvert(src, countingWriter, countingMappingTuple);
+    EXPECT_EQ(g_serializedSizeCalls, 0u);
+    EXPECT_EQ(countingWriter.capacity(), TLV_HEADER_SIZE + sizeof(int64_t));
+    EXPECT_EQ(countingWriter.size(), countingWriter.capacity());
+}
+
+// 测试子结构体原地写入：带键名的记录回填长度，内容为空的子结构体不输出记录
+TEST_F(TLVWriterTest, SubStructTLVConverter_InPlace) {
+    auto subStructMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0xB002)
+    );
+    auto emptyMappingTuple = MakeMappingRuleTuple();
+    auto parentMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<0>(), 0xB001, emptyMappingTuple),
+        MAKE_TLV_SUB_STRUCT_MAPPING_WITH_KEY(MakeFieldPath<0>(), 0xB003, subStructMappingTuple, SUB_STRUCT_KEY_NAME)
+    );
+
+    ParentStruct parentStruct{{321, 6.5}};
+    auto sharedWriter = std::make_shared<TLVWriter>(0);
+    StructFieldsConvert(parentStruct, sharedWriter, parentMappingTuple);
+
+    size_t keyLen = sizeof(SUB_STRUCT_KEY_NAME);
+    size_t expectedValueLen = keyLen + TLV_HEADER_SIZE + sizeof(int32_t);
+    ASSERT_EQ(sharedWriter->size(), TLV_HEADER_SIZE + expectedValueLen);
+    EXPECT_EQ(sharedWriter->capacity(), sharedWriter->size());
+
+    const uint8_t* data = sharedWriter->data();
+    uint32_t actualType;
+    uint32_t actualLength;
+    memcpy(&actualType, data, sizeof(uint32_t));
+    memcpy(&actualLength, data + sizeof(uint32_t), sizeof(uint32_t));
+    EXPECT_EQ(actualType, 0xB003u);
+    EXPECT_EQ(actualLength, expectedValueLen);
+    EXPECT_EQ(memcmp(data + TLV_HEADER_SIZE, SUB_STRUCT_KEY_NAME, keyLen), 0);
+
+    int32_t actualIntValue;
+    memcpy(&actualIntValue, data + TLV_HEADER_SIZE + keyLen + TLV_HEADER_SIZE, sizeof(int32_t));
+    EXPECT_EQ(actualIntValue, parentStruct.subData.intField);
+}
+
+// 只接受写入器引用的自定义转换器
+struct ReferenceStringConverter {
+    template <typename Sink>
+    void operator()(const int32_t& value, BasicTLVWriter<Sink>& dst) const
+    {
+        std::string text = std::to_string(value);
+        dst.AppendBuf(0xC003, text.data(), text.size());
+    }
+};
+
+// 以 shared_ptr 为参数的旧式自定义转换器
+struct SharedStringConverter {
+    template <typename Sink>
+    void operator()(const int32_t& value, std::shared_ptr<BasicTLVWriter<Sink>>& dst) const
+    {
+        std::string text = std::to_string(value);
+        dst->AppendBuf(0xC003, text.data(), text.size());
+    }
+};
+
+// 测试以引用传入栈上的写入器：输出与 shared_ptr 接口一致，两种形式的自定义转换器均可使用
+TEST_F(TLVWriterTest, StackWriter) {
+    auto subStructMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0xC002)
+    );
+    auto mappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<0>(), 0xC001, subStructMappingTuple),
+        MakeFieldMappingTLVCustomRule(MakeFieldPath<0, 0>(), ReferenceStringConverter{})
+    );
+    auto legacyMappingTuple = MakeMappingRuleTuple(
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<0>(), 0xC001, subStructMappingTuple),
+        MakeFieldMappingTLVCustomRule(MakeFieldPath<0, 0>(), SharedStringConverter{})
+    );
+    ParentStruct parentStruct{{-42, 6.5}};
+
+    TLVWriter stackWriter(256);
+    StructFieldsConvert(parentStruct, stackWriter, mappingTuple);
+    auto sharedWriter = std::make_shared<TLVWriter>(256);
+    StructFieldsConvert(parentStruct, sharedWriter, legacyMappingTuple);
+
+    EXPECT_EQ(stackWriter.status(), TLV_OK);
+    ASSERT_EQ(stackWriter.size(), 2 * TLV_HEADER_SIZE + sizeof(int32_t) + TLV_HEADER_SIZE + 3);
+    ASSERT_EQ(sharedWriter->size(), stackWriter.size());
+    EXPECT_EQ(memcmp(sharedWriter->data(), stackWriter.data(), stackWriter.size()), 0);
+    EXPECT_EQ(memcmp(stackWriter.data() + stackWriter.size() - 3, "-42", 3), 0);
+
+    // 泛型 lambda：旧式的按 shared_ptr 调用，以引用为参数的通过 MakeTLVWriterConverter 声明
+    auto legacyLambdaTuple = MakeMappingRuleTuple(
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<0>(), 0xC001, subStructMappingTuple),
+        MakeFieldMappingTLVCustomRule(MakeFieldPath<0, 0>(), [](const auto& value, auto& dst) {
+            std::string text = std::to_string(value);
+            dst->AppendBuf(0xC003, text.data(), text.size());
+        })
+    );
+    auto lambdaTuple = MakeMappingRuleTuple(
+        MAKE_TLV_SUB_STRUCT_MAPPING(MakeFieldPath<0>(), 0xC001, subStructMappingTuple),
+        MakeFieldMappingTLVCustomRule(MakeFieldPath<0, 0>(), MakeTLVWriterConverter([](const auto& value, auto& dst) {
+            std::string text = std::to_string(value);
+            dst.AppendBuf(0xC003, text.data(), text.size());
+        }))
+    );
+    TLVWriter legacyLambdaWriter(256);
+    StructFieldsConvert(parentStruct, legacyLambdaWriter, legacyLambdaTuple);
+    TLVWriter lambdaWriter(256);
+    StructFieldsConvert(parentStruct, lambdaWriter, lambdaTuple);
+    ASSERT_EQ(legacyLambdaWriter.size(), stackWriter.size());
+    EXPECT_EQ(memcmp(legacyLambdaWriter.data(), stackWriter.data(), stackWriter.size()), 0);
+    ASSERT_EQ(lambdaWriter.size(), stackWriter.size());
+    EXPECT_EQ(memcmp(lambdaWriter.data(), stackWriter.data(), stackWriter.size()), 0);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file test_tlv_writer_pool.cpp
+ * @author Zhiwei Tan (zhiweix1988@gmail.com)
+ * @brief TLVWriter 对象池测试
+ * @version 0.1
+ * @date 2025-09-13 10:00:00
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include "define_tuple_interface.h"
+#include "field_convert.h"
+#include "tlv_writer.h"
+#include "tlv_writer_pool.h"
+
+using namespace csrl;
+
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(PoolRecord,
+    (uint32_t, id),
+    (double, value)
+);
+
+// 测试归还后复用同一个写入器，以及按容量等级取出
+TEST(TLVWriterPoolTest, Recycle) {
+    TLVWriterPool pool;
+    auto rules = MakeMappingRuleTuple(
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<0>(), 0x01),
+        MAKE_TLV_DEFAULT_MAPPING(MakeFieldPath<1>(), 0x02)
+    );
+    PoolRecord record{1, 2.5};
+
+    const TLVWriter* first = nullptr;
+    {
+        PooledTLVWriter writer = pool.Acquire(100);
+        ASSERT_TRUE(writer);
+        EXPECT_GE(writer->capacity(), 256u);
+        StructFieldsConvert(record, *writer, rules);
+        EXPECT_EQ(writer->size(), 2 * TLV_HEADER_SIZE + sizeof(uint32_t) + sizeof(double));
+        first = &*writer;
+    }
+    EXPECT_EQ(pool.Misses(), 1u);
+    EXPECT_EQ(pool.RetainedBytes(), 256u);
+
+    {
+        // 归还的写入器已清空
+        PooledTLVWriter writer = pool.Acquire(200);
+        EXPECT_EQ(&*writer, first);
+        EXPECT_EQ(writer->size(), 0u);
+        EXPECT_EQ(pool.RetainedBytes(), 0u);
+
+        // 缓存中没有足够大的写入器
+        PooledTLVWriter large = pool.Acquire(4096);
+        EXPECT_NE(&*large, first);
+        EXPECT_GE(large->capacity(), 4096u);
+    }
+    EXPECT_EQ(pool.Hits(), 1u);
+    EXPECT_EQ(pool.Misses(), 2u);
+    EXPECT_EQ(pool.RetainedBytes(), 256u + 4096u);
+
+    // 大请求可以由更高等级的写入器满足
+    {
+        PooledTLVWriter writer = pool.Acquire(1024);
+        EXPECT_GE(writer->capacity(), 1024u);
+    }
+    EXPECT_EQ(pool.Hits(), 2u);
+
+    pool.Trim();
+    EXPECT_EQ(pool.RetainedBytes(), 0u);
+}
+
+// 测试缓存上限、移动以及线程独立的对象池
+TEST(TLVWriterPoolTest, Limits) {
+    TLVWriterPool pool(1024);
+    {
+        PooledTLVWriter small = pool.Acquire(512);
+        PooledTLVWriter large = pool.Acquire(2048);
+    }
+    EXPECT_EQ(pool.RetainedBytes(), 512u);
+    EXPECT_EQ(pool.Drops(), 1u);
+
+    {
+        PooledTLVWriter writer = pool.Acquire(512);
+        EXPECT_EQ(&writer.Get(), &*writer);
+        EXPECT_EQ(pool.RetainedBytes(), 0u);
+    }
+    EXPECT_EQ(pool.RetainedBytes(), 512u);
+    pool.Trim();
+
+    PooledTLVWriter moved = pool.Acquire();
+    PooledTLVWriter target(std::move(moved));
+    EXPECT_FALSE(moved);
+    target.Release();
+    EXPECT_FALSE(target);
+    EXPECT_EQ(pool.RetainedBytes(), 256u);
+
+    TLVWriterPool* mainPool = &TLVWriterPool::ThreadLocal();
+    TLVWriterPool* otherPool = nullptr;
+    std::thread([&otherPool]() { otherPool = &TLVWriterPool::ThreadLocal(); }).join();
+    EXPECT_NE(mainPool, otherPool);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "bind_to_tuple.h"
 #include "define_tuple_interface.h"
+#include "field_names.h"
 #include <string>
 #include <type_traits>
 
@@ -25,6 +26,62 @@ TEST(TupleInterfaceTest, BasicStructDefinition)
     EXPECT_EQ(std::tuple_size<Person>::value, 3);
 }
 
+// 测试字段数上限：128 个字段
+DEFINE_STRUCT_WITH_TUPLE_INTERFACE(WideStruct,
+    (uint8_t, f0), (uint8_t, f1), (uint8_t, f2), (uint8_t, f3), (uint8_t, f4), (uint8_t, f5), (uint8_t, f6), (uint8_t, f7),
+    (uint8_t, f8), (uint8_t, f9), (uint8_t, f10), (uint8_t, f11), (uint8_t, f12), (uint8_t, f13), (uint8_t, f14), (uint8_t, f15),
+    (uint8_t, f16), (uint8_t, f17), (uint8_t, f18), (uint8_t, f19), (uint8_t, f20), (uint8_t, f21), (uint8_t, f22), (uint8_t, f23),
+    (uint8_t, f24), (uint8_t, f25), (uint8_t, f26), (uint8_t, f27), (uint8_t, f28), (uint8_t, f29), (uint8_t, f30), (uint8_t, f31),
+    (uint8_t, f32), (uint8_t, f33), (uint8_t, f34), (uint8_t, f35), (uint8_t, f36), (uint8_t, f37), (uint8_t, f38), (uint8_t, f39),
+    (uint8_t, f40), (uint8_t, f41), (uint8_t, f42), (uint8_t, f43), (uint8_t, f44), (uint8_t, f45), (uint8_t, f46), (uint8_t, f47),
+    (uint8_t, f48), (uint8_t, f49), (uint8_t, f50), (uint8_t, f51), (uint8_t, f52), (uint8_t, f53), (uint8_t, f54), (uint8_t, f55),
+    (uint8_t, f56), (uint8_t, f57), (uint8_t, f58), (uint8_t, f59), (uint8_t, f60), (uint8_t, f61), (uint8_t, f62), (uint8_t, f63),
+    (uint8_t, f64), (uint8_t, f65), (uint8_t, f66), (uint8_t, f67), (uint8_t, f68), (uint8_t, f69), (uint8_t, f70), (uint8_t, f71),
+    (uint8_t, f72), (uint8_t, f73), (uint8_t, f74), (uint8_t, f75), (uint8_t, f76), (uint8_t, f77), (uint8_t, f78), (uint8_t, f79),
+    (uint8_t, f80), (uint8_t, f81), (uint8_t, f82), (uint8_t, f83), (uint8_t, f84), (uint8_t, f85), (uint8_t, f86), (uint8_t, f87),
+    (uint8_t, f88), (uint8_t, f89), (uint8_t, f90), (uint8_t, f91), (uint8_t, f92), (uint8_t, f93), (uint8_t, f94), (uint8_t, f95),
+    (uint8_t, f96), (uint8_t, f97), (uint8_t, f98), (uint8_t, f99), (uint8_t, f100), (uint8_t, f101), (uint8_t, f102), (uint8_t, f103),
+    (uint8_t, f104), (uint8_t, f105), (uint8_t, f106), (uint8_t, f107), (uint8_t, f108), (uint8_t, f109), (uint8_t, f110), (uint8_t, f111),
+    (uint8_t, f112), (uint8_t, f113), (uint8_t, f114), (uint8_t, f115), (uint8_t, f116), (uint8_t, f117), (uint8_t, f118), (uint8_t, f119),
+    (uint8_t, f120), (uint8_t, f121), (uint8_t, f122), (uint8_t, f123), (uint8_t, f124), (uint8_t, f125), (uint8_t, f126), (uint8_t, f127)
+)
+
+TEST(TupleInterfaceTest, WideStruct)
+{
+    static_assert(std::tuple_size<WideStruct>::value == 128, "WideStruct should have 128 fields");
+    static_assert(std::is_same<std::tuple_element_t<127, WideStruct>, uint8_t>::value, "last field type mismatch");
+
+    WideStruct w{};
+    w.f0 = 1;
+    w.f127 = 2;
+    EXPECT_EQ(std::get<0>(w), 1);
+    EXPECT_EQ(std::get<127>(w), 2);
+    EXPECT_STREQ((csrl::FieldNameGetter<WideStruct, 64>::Get()), "f64");
+    EXPECT_EQ((csrl::FieldNameGetter<WideStruct, 127>::Length()), 4u);
+}
+
+// 测试编译期字段名表与字段名 → 下标查找
+TEST(TupleInterfaceTest, FieldNames)
+{
+    using PersonNames = csrl::FieldNames<Person>;
+    static_assert(PersonNames::m_count == 3, "Person should have 3 field names");
+    static_assert(PersonNames::m_lengths[2] == 6, "height has 6 characters");
+    static_assert(csrl::FieldIndexOf<Person>("name") == 0, "name is field 0");
+    static_assert(csrl::FieldIndexOf<Person>("height") == 2, "height is field 2");
+    static_assert(csrl::FieldIndexOf<Person>("weight") == 3, "unknown names map to the field count");
+    static_assert(std::get<1>(PersonNames::Literals()).size() == 3, "age has 3 characters");
+    static_assert(std::get<1>(PersonNames::Literals())[0] == 'a', "literal keeps the field name");
+
+    // 运行期查找与下标一一对应
+    for (size_t i = 0; i < 128; ++i) {
+        std::string name = "f" + std::to_string(i);
+        EXPECT_EQ(csrl::FieldIndexOf<WideStruct>(name.data(), name.size()), i);
+    }
+    EXPECT_EQ(csrl::FieldIndexOf<WideStruct>("f128"), 128u);
+    EXPECT_EQ(csrl::FieldIndexOf<WideStruct>("f1", 1), 128u);
+    EXPECT_EQ(std::get<0>(PersonNames::Literals()).str(), "name");
+}
+
 #if 0
 
 // 测试 bind_to_tuple 功能